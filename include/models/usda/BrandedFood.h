@@ -1,5 +1,6 @@
 #pragma once
 
+#include "models/usda/Unit.h"
 #include <chrono>
 #include <optional>
 #include <string>
@@ -16,7 +17,8 @@ typedef struct {
   std::optional<std::string> not_a_significant_source_of;
 
   std::optional<float> serving_size;
-  std::optional<std::string> serving_size_unit;
+  std::optional<std::string> serving_size_unit; // Raw unit, if unrecognized
+  Unit serving_unit = Unit::Unknown;            // Normalized serving unit
   std::optional<std::string> household_serving_fulltext;
 
   std::optional<std::string> branded_food_category;
@@ -33,5 +35,13 @@ typedef struct {
   std::optional<std::string> trade_channel;
   std::optional<std::string> short_description;
   std::optional<std::string> material_code;
+
+  // Keys into the lookup tables of the repeated columns above, 0 while the
+  // value is missing (see BrandedFoodDimensionTransformer)
+  int brand_owner_id = 0;
+  int branded_food_category_id = 0;
+  int data_source_id = 0;
+  int market_country_id = 0;
+  int serving_size_unit_id = 0;
 } BrandedFood;
 } // namespace USDA
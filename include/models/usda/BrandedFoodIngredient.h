@@ -0,0 +1,9 @@
+#pragma once
+
+namespace USDA {
+typedef struct {
+  int fdc_id;        // Foreign key to BrandedFood.fdc_id
+  int ingredient_id; // Foreign key to Ingredient.id
+  int position;      // 1-based order of the ingredient on the label
+} BrandedFoodIngredient;
+} // namespace USDA
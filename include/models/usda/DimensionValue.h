@@ -0,0 +1,10 @@
+#pragma once
+
+#include <string>
+
+namespace USDA {
+typedef struct {
+  int id;           // Primary key (internal to its lookup table)
+  std::string name; // Distinct column value (e.g., a brand owner)
+} DimensionValue;
+} // namespace USDA
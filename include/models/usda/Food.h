@@ -5,7 +5,22 @@
 #include <string>
 
 namespace USDA {
-enum class FoodDataType { Foundation, Branded };
+enum class FoodDataType { Foundation, Branded, SrLegacy, Survey };
+
+/** Returns the data_type value of a food type as written in food.csv */
+constexpr const char *DataTypeName(FoodDataType data_type) {
+  switch (data_type) {
+  case FoodDataType::Foundation:
+    return "foundation_food";
+  case FoodDataType::Branded:
+    return "branded_food";
+  case FoodDataType::SrLegacy:
+    return "sr_legacy_food";
+  case FoodDataType::Survey:
+    return "survey_fndds_food";
+  }
+  return "";
+}
 
 typedef struct {
   int fdc_id; // Primary key (internal to this table)
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+namespace USDA {
+typedef struct {
+  int id;     // Primary key of the attribute record
+  int fdc_id; // Foreign key to Food.fdc_id
+  std::optional<int> seq_num;                // Sequence number (for ordering)
+  std::optional<int> food_attribute_type_id; // e.g., common name, adjustment
+  std::optional<std::string> name;           // Attribute name
+  std::optional<std::string> value;          // Attribute value
+} FoodAttribute;
+} // namespace USDA
@@ -9,6 +9,7 @@ typedef struct {
   int fdc_id;      // Foreign key to Food.fdc_id
   int nutrient_id; // Foreign key to Nutrient.id
   std::optional<float> amount;    // Amount of the nutrient in 100g of food
+  std::optional<float> amount_per_serving; // Amount in one labeled serving
 
   // Optional metadata
   std::optional<int> data_points;
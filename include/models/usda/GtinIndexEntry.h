@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+namespace USDA {
+typedef struct {
+  std::uint64_t gtin; // Canonical GTIN-14 as an integer (leading zeros implied)
+  int fdc_id;         // Foreign key to Food.fdc_id
+} GtinIndexEntry;
+} // namespace USDA
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <string>
+
+namespace USDA {
+typedef struct {
+  int id;           // Primary key (internal to this table)
+  std::string name; // Case-folded, trimmed ingredient name (e.g., "sugar")
+} Ingredient;
+} // namespace USDA
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+namespace USDA {
+typedef struct {
+  int id;     // Primary key of the input record
+  int fdc_id; // Foreign key to Food.fdc_id of the composed food
+  std::optional<int> fdc_id_of_input_food; // FDC ID of the ingredient food
+  std::optional<int> seq_num;              // Sequence number (for ordering)
+  std::optional<float> amount;             // Quantity of the ingredient
+  std::optional<int> sr_code;              // SR Legacy code of the ingredient
+  std::optional<std::string> sr_description; // SR Legacy description
+  std::optional<std::string> unit;           // Unit of the amount
+  std::optional<std::string> portion_code;   // FNDDS portion code
+  std::optional<std::string> portion_description; // e.g., "1 cup"
+  std::optional<float> gram_weight;               // Weight in grams
+  std::optional<int> retention_code; // Nutrient retention factor code
+} InputFood;
+} // namespace USDA
@@ -1,10 +1,12 @@
 #pragma once
 
+#include "models/usda/Unit.h"
 #include <string>
 
 namespace USDA {
 typedef struct {
   int id; // Primary key (internal to this table)
   std::string name;
+  Unit unit = Unit::Unknown; // Normalized name, Unknown for household measures
 } MeasureUnit;
 } // namespace USDA
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "models/usda/Unit.h"
 #include <optional>
 #include <string>
 
@@ -8,6 +9,7 @@ typedef struct {
   int id;                // Primary key (used in food_nutrient)
   std::string name;      // Nutrient name (e.g., "Protein")
   std::string unit_name; // Unit (e.g., "g", "mg", "µg")
+  Unit unit = Unit::Unknown;               // Normalized unit_name
   std::optional<std::string> nutrient_nbr; // Legacy ID, sometimes blank
   std::optional<int> rank;                 // Display or sort order
 } Nutrient;
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+
+namespace USDA {
+typedef struct {
+  std::string category_type; // "food_category" or "branded_food_category"
+  std::string category;      // food_category_id or branded_food_category
+  int nutrient_id;           // Foreign key to Nutrient.id
+  int food_count;            // Foods of the category with an amount
+  double mean;               // Mean amount in 100g of food
+  double p10;                // 10th percentile amount
+  double median;             // Median amount
+  double p90;                // 90th percentile amount
+} NutrientCategoryStat;
+} // namespace USDA
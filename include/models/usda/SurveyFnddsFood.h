@@ -0,0 +1,14 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+namespace USDA {
+typedef struct {
+  int fdc_id;    // Primary key; foreign key to Food.fdc_id
+  int food_code; // FNDDS food code
+  std::optional<int> wweia_category_code; // WWEIA food category
+  std::optional<std::chrono::year_month_day> start_date; // Survey start
+  std::optional<std::chrono::year_month_day> end_date;   // Survey end
+} SurveyFnddsFood;
+} // namespace USDA
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+
+namespace USDA {
+/** Closed set of units used by serving sizes, nutrients and measure units */
+enum class Unit : std::uint8_t {
+  Unknown, // Unrecognized or household measure (e.g., "slice", "RACC")
+
+  // Mass
+  Gram,
+  Milligram,
+  Microgram,
+  Kilogram,
+  Ounce,
+  Pound,
+
+  // Volume
+  Milliliter,
+  Liter,
+  FluidOunce,
+  Teaspoon,
+  Tablespoon,
+  Cup,
+  Pint,
+  Quart,
+  Gallon,
+  CubicInch,
+
+  // Energy
+  Kilocalorie,
+  Kilojoule,
+
+  // Nutrient-specific units
+  InternationalUnit,
+  MilligramAlphaTocopherolEquivalent, // MG_ATE
+  MilligramGallicAcidEquivalent,      // MG_GAE
+  MicromoleTroloxEquivalent,          // UMOL_TE
+  SpecificGravity,                    // SP_GR
+  PH,
+};
+
+/** Physical quantity measured by a Unit */
+enum class UnitDimension : std::uint8_t { None, Mass, Volume, Energy };
+
+/** Returns the quantity a unit measures */
+constexpr UnitDimension DimensionOf(Unit unit) {
+  switch (unit) {
+  case Unit::Gram:
+  case Unit::Milligram:
+  case Unit::Microgram:
+  case Unit::Kilogram:
+  case Unit::Ounce:
+  case Unit::Pound:
+    return UnitDimension::Mass;
+  case Unit::Milliliter:
+  case Unit::Liter:
+  case Unit::FluidOunce:
+  case Unit::Teaspoon:
+  case Unit::Tablespoon:
+  case Unit::Cup:
+  case Unit::Pint:
+  case Unit::Quart:
+  case Unit::Gallon:
+  case Unit::CubicInch:
+    return UnitDimension::Volume;
+  case Unit::Kilocalorie:
+  case Unit::Kilojoule:
+    return UnitDimension::Energy;
+  default:
+    return UnitDimension::None;
+  }
+}
+
+/**
+ * Returns how many base units (grams, milliliters or kilocalories) one unit
+ * is worth, or 0 for units without a base unit.
+ */
+constexpr double BaseUnitsPer(Unit unit) {
+  switch (unit) {
+  case Unit::Gram:
+    return 1.0;
+  case Unit::Milligram:
+    return 1e-3;
+  case Unit::Microgram:
+    return 1e-6;
+  case Unit::Kilogram:
+    return 1000.0;
+  case Unit::Ounce:
+    return 28.349523125;
+  case Unit::Pound:
+    return 453.59237;
+  case Unit::Milliliter:
+    return 1.0;
+  case Unit::Liter:
+    return 1000.0;
+  case Unit::FluidOunce:
+    return 29.5735295625;
+  case Unit::Teaspoon:
+    return 4.92892159375;
+  case Unit::Tablespoon:
+    return 14.78676478125;
+  case Unit::Cup:
+    return 236.5882365;
+  case Unit::Pint:
+    return 473.176473;
+  case Unit::Quart:
+    return 946.352946;
+  case Unit::Gallon:
+    return 3785.411784;
+  case Unit::CubicInch:
+    return 16.387064;
+  case Unit::Kilocalorie:
+    return 1.0;
+  case Unit::Kilojoule:
+    return 1.0 / 4.184;
+  default:
+    return 0.0;
+  }
+}
+
+/** Returns the canonical symbol of a unit, or nullptr for Unit::Unknown */
+constexpr const char *UnitSymbol(Unit unit) {
+  switch (unit) {
+  case Unit::Gram:
+    return "g";
+  case Unit::Milligram:
+    return "mg";
+  case Unit::Microgram:
+    return "\xC2\xB5g";
+  case Unit::Kilogram:
+    return "kg";
+  case Unit::Ounce:
+    return "oz";
+  case Unit::Pound:
+    return "lb";
+  case Unit::Milliliter:
+    return "ml";
+  case Unit::Liter:
+    return "l";
+  case Unit::FluidOunce:
+    return "fl oz";
+  case Unit::Teaspoon:
+    return "tsp";
+  case Unit::Tablespoon:
+    return "tbsp";
+  case Unit::Cup:
+    return "cup";
+  case Unit::Pint:
+    return "pt";
+  case Unit::Quart:
+    return "qt";
+  case Unit::Gallon:
+    return "gal";
+  case Unit::CubicInch:
+    return "in3";
+  case Unit::Kilocalorie:
+    return "kcal";
+  case Unit::Kilojoule:
+    return "kJ";
+  case Unit::InternationalUnit:
+    return "IU";
+  case Unit::MilligramAlphaTocopherolEquivalent:
+    return "mg ATE";
+  case Unit::MilligramGallicAcidEquivalent:
+    return "mg GAE";
+  case Unit::MicromoleTroloxEquivalent:
+    return "\xC2\xB5mol TE";
+  case Unit::SpecificGravity:
+    return "sp gr";
+  case Unit::PH:
+    return "pH";
+  default:
+    return nullptr;
+  }
+}
+} // namespace USDA
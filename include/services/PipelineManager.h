@@ -1,27 +1,50 @@
 #pragma once
 
 #include "models/usda/BrandedFood.h"
-#include "services/extractors/BrandedFoodExtractorService.h"
-#include "services/extractors/FoodCategoryExtractorService.h"
-#include "services/extractors/FoodExtractorService.h"
-#include "services/extractors/FoodNutrientExtractorService.h"
-#include "services/extractors/FoodPortionExtractorService.h"
-#include "services/extractors/MeasureUnitExtractorService.h"
-#include "services/extractors/NutrientExtractorService.h"
+#include "models/usda/BrandedFoodIngredient.h"
+#include "models/usda/GtinIndexEntry.h"
+#include "models/usda/Ingredient.h"
+#include "models/usda/NutrientCategoryStat.h"
+#include "services/Profile.h"
+#include "services/extractors/Extractor.h"
+#include "services/extractors/schemas/BrandedFoodSchema.h"
+#include "services/extractors/schemas/FoodAttributeSchema.h"
+#include "services/extractors/schemas/FoodCategorySchema.h"
+#include "services/extractors/schemas/FoodNutrientSchema.h"
+#include "services/extractors/schemas/FoodPortionSchema.h"
+#include "services/extractors/schemas/FoodSchema.h"
+#include "services/extractors/schemas/InputFoodSchema.h"
+#include "services/extractors/schemas/MeasureUnitSchema.h"
+#include "services/extractors/schemas/NutrientSchema.h"
+#include "services/extractors/schemas/SurveyFnddsFoodSchema.h"
+#include "services/loaders/SQLiteLoaderService.h"
+#include "services/transformers/BrandedFoodDimensionTransformer.h"
+#include "services/transformers/DatasetMergeTransformer.h"
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 /**
  * @class PipelineManager
  * @brief Manages the ETL (Extract, Transform, Load) pipeline for USDA Food Central data.
  *
  * This class coordinates the complete data processing workflow:
- * 1. Extraction of raw data from CSV files using specialized extractor services
+ * 1. Extraction of raw data from CSV files using schema-driven extractors
  * 2. Transformation of the data to ensure integrity and consistency
- * 3. Future: Loading of processed data into target destinations
+ * 3. Loading of processed data into target destinations
+ * 4. Building secondary indexes over the loaded tables
+ * 5. Publishing the finished database atomically in place of the old one
  *
- * The PipelineManager handles concurrent extraction of data using async tasks
- * and manages the memory-efficient processing of large USDA food datasets.
+ * Besides the primary release (the full or branded download), the Foundation,
+ * SR Legacy and Survey (FNDDS) releases can be configured as additional
+ * datasets. Their per-food tables are extracted alongside the primary ones
+ * and merged into the same database (see DatasetMergeTransformer); the
+ * shared lookup tables (nutrients, measure units, food categories) are taken
+ * from the primary release.
+ *
+ * The PipelineManager extracts every table of every release concurrently on
+ * one worker pool and manages the memory-efficient processing of large USDA
+ * food datasets.
  */
 class PipelineManager {
 public:
@@ -37,6 +60,40 @@ public:
    *                  - "food_portion_input_file"
    *                  - "measure_unit_input_file"
    *                  - "branded_food_input_file"
+   *                  Input files may be plain CSV files, gzip files
+   *                  ("food.csv.gz") or zip members
+   *                  ("FoodData_Central.zip!food.csv").
+   *                  Optional keys:
+   *                  - "fdc_archive" (zip archive supplying every required
+   *                    input that is not listed explicitly)
+   *                  - "full_text_search" ("true" builds the FTS5 tables)
+   *                  - "read_backend" ("mmap", "io_uring" or "pread"; how
+   *                    plain CSV files are read)
+   *                  - "date_format" ("iso" or "days"; "days" stores dates
+   *                    as INTEGER day numbers since 1970-01-01)
+   *                  - "profile" ("full" or "nutrition-core"; which tables
+   *                    and columns are materialized, see Profile)
+   *                  - "tables" (comma-separated CSV tables to load,
+   *                    replacing the profile's selection)
+   *                  - "exclude_columns" (comma-separated "table.column"
+   *                    entries left unparsed and unloaded)
+   *                  - "validation_sql" (file of SQL statements run
+   *                    against the transformed rows before the load, see
+   *                    ValidateData())
+   *                  - "data_profile" (JSON file receiving per-column
+   *                    statistics of the extracted rows, see
+   *                    DataProfileReport)
+   *                  - "vacuum" ("true" compacts the database before it
+   *                    is published)
+   *                  - "output_profile" ("standard" or "compact"; "compact"
+   *                    publishes a read-optimized copy for shipping, see
+   *                    PublishData())
+   *                  - "build_report" (JSON file receiving the size of
+   *                    every table and index of the published database)
+   *                  - "<release>_archive" and
+   *                    "<release>_<table>_input_file" for the release
+   *                    "foundation", "sr_legacy" or "survey" (an additional
+   *                    dataset; active once its food input is known)
    * @throws std::out_of_range If any required key is missing from input_map
    */
   PipelineManager(
@@ -51,37 +108,153 @@ public:
   void ProcessData();
 
 private:
+  /**
+   * @brief Fills in input files that come from the "fdc_archive" zip.
+   *
+   * Additional releases are filled in the same way from their
+   * "<release>_archive" zip.
+   *
+   * @param input_map Input map as read from input_locations.txt
+   * @return The input map with a "<archive>!<name>.csv" location for every
+   *         required input that is not listed explicitly
+   */
+  static std::unordered_map<std::string, std::string>
+  withArchiveDefaults(
+      const std::unordered_map<std::string, std::string> &input_map);
+
+  /**
+   * @brief Identifies the inputs and settings the loaded rows come from.
+   *
+   * @return Hex digest of every input's location, size and modification
+   *         time and of the settings that change the loaded rows
+   */
+  std::string inputFingerprint() const;
+
   /**
    * @brief Extracts data from all input files concurrently.
    *
-   * Launches multiple async tasks to parse different data types in parallel,
-   * optimizing for performance while managing memory usage. Results are moved
-   * into member vectors with reporting of extraction statistics.
+   * The tables of the primary release and of every additional dataset are
+   * queued on one worker pool, largest expected table first, so the long
+   * tables start early and the short ones fill the remaining threads.
+   * Results are moved into member vectors with reporting of extraction
+   * statistics. With "data_profile" set, every extractor also profiles its
+   * columns while parsing, and the profiles are merged per table and
+   * written as JSON.
+   *
+   * @return true if every input was read to the end; false if one could
+   *         not be opened or ended early (see Extractor::Failed())
    */
-  void ExtractData();
+  bool ExtractData();
 
   /**
    * @brief Applies transformation operations to ensure data integrity.
    *
    * Executes a series of transformers to clean and validate the extracted data.
    * Current transformations:
+   * - Merging the additional datasets into the primary release
    * - Removing entries with invalid FDC ID references
+   * - Normalizing unit strings and deriving portion gram weights
+   * - Computing per-serving nutrient amounts
+   * - Keeping only the latest branded food submission per GTIN
+   * - Building the normalized GTIN barcode index
+   * - Parsing ingredient labels into a normalized ingredient dictionary
+   * - Summarizing nutrient amounts per food category
+   * - Moving repeated branded food columns into lookup tables
    */
   void TransformData();
 
   /**
-   * @brief Loads the data into the database.
+   * @brief Runs the "validation_sql" statements over the transformed rows.
+   *
+   * The extracted vectors are exposed as virtual tables v_<table> (see
+   * MemoryTableModule) on an in-memory connection, so ad-hoc checks run
+   * before anything is written; the output database can be ATTACHed from
+   * the script. Does nothing unless "validation_sql" is set.
+   */
+  void ValidateData();
+
+  /**
+   * @brief Loads the data into the build database (BUILD_FILE).
+   *
+   * Loads are checkpointed: a rerun over the same inputs after an
+   * interruption resumes each table after its last committed batch.
+   *
+   * @return true if every table was loaded, false otherwise
    */
-  void LoadData();
+  bool LoadData();
+
+  /**
+   * @brief Builds the secondary indexes and planner statistics.
+   *
+   * Runs after LoadData() so that the bulk load only maintains primary keys.
+   *
+   * @return true if every index was built, false otherwise
+   */
+  bool IndexData();
+
+  /**
+   * @brief Publishes the finished build as DATABASE_FILE.
+   *
+   * Optionally VACUUMs the build ("vacuum" set to "true"), switches it to
+   * WAL mode and renames it over DATABASE_FILE, so readers never see a
+   * partial load and never wait on the loader's locks (see
+   * SQLiteLoaderService::Publish()). In the compact output profile a
+   * read-optimized copy (SQLiteLoaderService::CompactInto()) is published
+   * instead and the build is removed. Only called when the extract, load
+   * and index stages succeeded; otherwise the build is kept for the next
+   * run to resume, and the published database is left as it was.
+   */
+  void PublishData();
+
+  /**
+   * @brief Output profile selected by "output_profile".
+   *
+   * @return Compact for "compact", Standard otherwise
+   */
+  SQLiteLoaderService::OutputProfile outputProfile() const;
+
+  /**
+   * @struct Dataset
+   * @brief An additional FDC release and the extractors of its tables.
+   */
+  struct Dataset {
+    /**
+     * @param name Release name, the prefix of its input keys ("foundation")
+     * @param data_type Food type the release contributes
+     * @param input_map Input map with the release's archive defaults
+     */
+    Dataset(const std::string &name, USDA::FoodDataType data_type,
+            const std::unordered_map<std::string, std::string> &input_map);
+
+    Extractor<USDA::FoodSchema> food_extractor;
+    Extractor<USDA::FoodNutrientSchema> food_nutrient_extractor;
+    Extractor<USDA::FoodPortionSchema> food_portion_extractor;
+    Extractor<USDA::FoodAttributeSchema> food_attribute_extractor;
+    Extractor<USDA::InputFoodSchema> input_food_extractor;
+    Extractor<USDA::SurveyFnddsFoodSchema> survey_fndds_food_extractor;
+
+    DatasetMergeTransformer::Release release; ///< Extracted tables
+  };
+
+  /** SQLite database read by consumers, replaced by PublishData() */
+  static constexpr const char *DATABASE_FILE = "usda-food-central.db";
+
+  /** Database written by the load and index stages, next to DATABASE_FILE */
+  static constexpr const char *BUILD_FILE = "usda-food-central.db.building";
+
+  /** Read-optimized copy of the build in the compact output profile */
+  static constexpr const char *COMPACT_FILE = "usda-food-central.db.compact";
 
   std::unordered_map<std::string, std::string> input_map;
-  FoodExtractorService food_extractor_service;
-  FoodCategoryExtractorService food_category_extractor_service;
-  NutrientExtractorService nutrient_extractor_service;
-  FoodNutrientExtractorService food_nutrient_extractor_service;
-  FoodPortionExtractorService food_portion_extractor_service;
-  MeasureUnitExtractorService measure_unit_extractor_service;
-  BrandedFoodExtractorService branded_food_extractor_service;
+  Profile profile; ///< Tables and columns to materialize
+  Extractor<USDA::FoodSchema> food_extractor;
+  Extractor<USDA::FoodCategorySchema> food_category_extractor;
+  Extractor<USDA::NutrientSchema> nutrient_extractor;
+  Extractor<USDA::FoodNutrientSchema> food_nutrient_extractor;
+  Extractor<USDA::FoodPortionSchema> food_portion_extractor;
+  Extractor<USDA::MeasureUnitSchema> measure_unit_extractor;
+  Extractor<USDA::BrandedFoodSchema> branded_food_extractor;
+  std::vector<Dataset> datasets; ///< Additional releases to merge in
 
   std::vector<USDA::FoodCategory> food_category_entries;
   std::vector<USDA::MeasureUnit> measure_unit_entries;
@@ -90,4 +263,12 @@ private:
   std::vector<USDA::Food> food_entries;
   std::vector<USDA::BrandedFood> branded_food_entries;
   std::vector<USDA::FoodNutrient> food_nutrient_entries;
+  std::vector<USDA::GtinIndexEntry> gtin_index_entries;
+  std::vector<USDA::Ingredient> ingredient_entries;
+  std::vector<USDA::BrandedFoodIngredient> branded_food_ingredient_entries;
+  std::vector<USDA::NutrientCategoryStat> nutrient_category_stat_entries;
+  BrandedFoodDimensionTransformer::Dictionaries branded_food_dimension_entries;
+  std::vector<USDA::FoodAttribute> food_attribute_entries;
+  std::vector<USDA::InputFood> input_food_entries;
+  std::vector<USDA::SurveyFnddsFood> survey_fndds_food_entries;
 };
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * @class Profile
+ * @brief Selects which tables and columns the pipeline materializes.
+ *
+ * Tables and columns are named as in the USDA CSV files ("food_nutrient",
+ * "footnote"). Tables left out of a profile are neither read nor loaded.
+ * Excluded columns are not converted by the extractors, stay empty in the
+ * models and are dropped from the database schema.
+ *
+ * Built-in profiles:
+ * - "full": every table and column (default)
+ * - "nutrition-core": foods, categories, nutrients and nutrient amounts,
+ *   plus the branded food columns needed for serving sizes and product
+ *   deduplication; no portions, measure units, ingredients or label
+ *   metadata
+ */
+class Profile {
+public:
+  /**
+   * @brief Builds the profile selected by the pipeline settings.
+   *
+   * @param settings Input map; reads the optional keys "profile" (built-in
+   *                 profile name), "tables" (comma-separated list replacing
+   *                 the profile's tables) and "exclude_columns"
+   *                 (comma-separated "table.column" entries excluded in
+   *                 addition to the profile's)
+   * @param profile Receives the profile
+   * @return false if the profile name is not recognized; profile is then
+   *         the "full" profile with the other settings applied
+   */
+  static bool FromSettings(
+      const std::unordered_map<std::string, std::string> &settings,
+      Profile &profile);
+
+  /** Name of the built-in profile this profile is based on */
+  const std::string &Name() const { return name; }
+
+  /** Returns true if the table is read and loaded */
+  bool IncludesTable(const std::string &table) const;
+
+  /** Returns true if the column of the table is materialized */
+  bool IncludesColumn(const std::string &table,
+                      const std::string &column) const;
+
+  /** Columns of the table that are not materialized */
+  const std::unordered_set<std::string> &
+  ExcludedColumns(const std::string &table) const;
+
+private:
+  std::string name = "full";
+  std::unordered_set<std::string> tables; ///< Included tables; empty = all
+  std::unordered_map<std::string, std::unordered_set<std::string>>
+      excluded_columns; ///< Excluded columns by table
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "services/extractors/CsvReader.h"
+#include "utils/AsyncFileStreamBuf.h"
+#include "utils/DecompressingStreamBuf.h"
+#include <memory>
+#include <string>
+
+/**
+ * @class CsvInput
+ * @brief Opens a CSV reader over a plain, gzip-compressed or zipped input.
+ *
+ * Input locations use one of these forms:
+ * - `path/to/food.csv` — read directly; memory-mapped window by window, or
+ *   through AsyncFileStreamBuf when an asynchronous read backend is selected
+ * - `path/to/food.csv.gz` — inflated on a background thread while parsing
+ * - `path/to/FoodData_Central_csv.zip!food.csv` — the named member of a zip
+ *   archive, inflated on a background thread while parsing; the member may be
+ *   given without the directory it is stored under
+ */
+class CsvInput {
+public:
+  /** How plain (uncompressed) CSV files are read */
+  enum class ReadBackend {
+    Mmap,    ///< Memory-mapped window by window (default)
+    IoUring, ///< Queued io_uring reads, falling back to pread if unavailable
+    Pread    ///< pread on a readahead thread
+  };
+
+  /**
+   * @brief Selects the backend used for plain inputs opened afterwards.
+   *
+   * @param backend Read backend for every following CsvInput
+   */
+  static void SetReadBackend(ReadBackend backend);
+
+  /**
+   * @brief Parses a "read_backend" setting value.
+   *
+   * @param name One of "mmap", "io_uring" or "pread"
+   * @param backend Receives the parsed backend
+   * @return false if the name is not recognized
+   */
+  static bool ParseReadBackend(const std::string &name, ReadBackend &backend);
+
+  /**
+   * @brief Returns the file an input location is read from.
+   *
+   * @param input_file Input location in one of the supported forms
+   * @return The archive path for zip members, the location itself otherwise
+   */
+  static std::string FilePath(const std::string &input_file);
+
+  /**
+   * @brief Opens the input and prepares a CSV reader over it.
+   *
+   * @param input_file Input location in one of the supported forms
+   */
+  CsvInput(const std::string &input_file);
+  ~CsvInput() = default;
+
+  CsvInput(const CsvInput &) = delete;
+  CsvInput &operator=(const CsvInput &) = delete;
+
+  /** Returns the reader to iterate rows from */
+  CsvReader &Reader() { return *reader; }
+
+  /**
+   * @brief Returns true if the input could not be read to the end.
+   *
+   * Only meaningful once all rows have been read.
+   */
+  bool Failed() const;
+
+private:
+  /** Decompressing buffer of a compressed input; owned by the reader */
+  DecompressingStreamBuf *decompressing_buffer = nullptr;
+  /** Asynchronous buffer of a plain input; owned by the reader */
+  AsyncFileStreamBuf *file_buffer = nullptr;
+  std::unique_ptr<CsvReader> reader;
+};
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "utils/StructuralIndex.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class CsvRow
+ * @brief The fields of one CSV row.
+ *
+ * Fields are views into the reader's buffer, with the enclosing quotes
+ * removed and doubled quotes collapsed. They stay valid until the reader
+ * reads the next row.
+ */
+class CsvRow {
+public:
+  /** Number of fields in the row */
+  std::size_t size() const { return fields.size(); }
+
+  /** Text of a field; column must be less than size() */
+  std::string_view operator[](std::size_t column) const {
+    return fields[column];
+  }
+
+private:
+  friend class CsvReader;
+
+  std::vector<std::string_view> fields;
+  std::vector<std::size_t> doubled_quotes; ///< Fields still to unescape
+  std::string unescaped; ///< Storage for the unescaped fields
+};
+
+/**
+ * @class CsvReader
+ * @brief Splits comma-separated input into rows.
+ *
+ * The input is read in windows of a few megabytes: page-aligned mappings of a
+ * plain file, or blocks pulled from a stream buffer. Each window is indexed
+ * with a StructuralIndex, and rows are cut at the separators it lists, so
+ * field bytes are never examined one at a time.
+ *
+ * Quoting follows the rules of the csv-parser library this reader replaced:
+ * a quote opens a quoted field only at the start of the field, doubled quotes
+ * inside it stand for one quote, and runs of CR and LF end a single row.
+ * Fields whose quotes do not match the index (a stray quote inside an
+ * unquoted field, text after a closing quote) switch the rest of the window
+ * to a byte-by-byte parser that applies those rules exactly. The first row is
+ * the header; a UTF-8 byte order mark before it is skipped.
+ *
+ * Line() reports the physical line a row starts on, counting line feeds, so
+ * rows with quoted line breaks span several lines.
+ */
+class CsvReader {
+public:
+  /**
+   * @brief Maps a plain file window by window.
+   *
+   * @param path File to read; Failed() reports if it cannot be read
+   */
+  explicit CsvReader(const std::string &path);
+
+  /**
+   * @brief Reads from a stream buffer, e.g. a decompressing one.
+   *
+   * @param source Buffer to read until its end
+   */
+  explicit CsvReader(std::unique_ptr<std::streambuf> source);
+
+  /** Unmaps the current window and closes the file */
+  ~CsvReader();
+
+  CsvReader(const CsvReader &) = delete;
+  CsvReader &operator=(const CsvReader &) = delete;
+
+  /** Column names from the header row */
+  const std::vector<std::string> &ColumnNames() const { return column_names; }
+
+  /**
+   * @brief Reads the next data row.
+   *
+   * @param row Receives the fields; the previous contents are replaced
+   * @return false once the input is exhausted
+   */
+  bool ReadRow(CsvRow &row);
+
+  /** 1-based physical line of the last row read; the header is line 1 */
+  std::uint64_t Line() const { return row_line; }
+
+  /** Returns true if the plain file could not be opened or mapped */
+  bool Failed() const { return failed; }
+
+private:
+  /** Outcome of cutting one row out of the window */
+  enum class RowStatus {
+    Complete,   ///< The row ends inside the window
+    Incomplete, ///< The window ends before the row does
+    Irregular,  ///< The quotes disagree with the index
+    None        ///< Only blank input was left
+  };
+
+  /** Bytes read per window; a window grows while a row does not fit */
+  static constexpr std::size_t WINDOW_BYTES = 4 * 1024 * 1024;
+
+  /** Reads the header row into column_names */
+  void readHeader();
+
+  /**
+   * @brief Moves the window to start at the current row and indexes it.
+   *
+   * @return false if the input is exhausted or cannot be read
+   */
+  bool refill();
+
+  /** Maps the file range of the window; false if mapping fails */
+  bool mapWindow(std::uint64_t offset, std::size_t length);
+
+  /** Advances past blank lines between rows */
+  void skipNewlines();
+
+  /** Cuts the next row at the indexed separators */
+  RowStatus indexedRow(CsvRow &row);
+
+  /** Parses the next row byte by byte */
+  RowStatus scannedRow(CsvRow &row);
+
+  /**
+   * @brief Appends the field [begin, end) cut at indexed separators.
+   *
+   * @return false if its quotes disagree with the index
+   */
+  bool addIndexedField(CsvRow &row, std::size_t begin, std::size_t end);
+
+  /** Collapses the doubled quotes of the fields that contain them */
+  static void unescapeFields(CsvRow &row);
+
+  const char *data = nullptr; ///< First byte of the window
+  std::size_t size = 0;       ///< Bytes in the window
+  std::size_t pos = 0;        ///< Start of the next row in the window
+  std::size_t cursor = 0;     ///< Next separator of the index
+  bool indexed = false;       ///< The index is valid from pos on
+  bool at_end = false;        ///< The window reaches the end of the input
+  bool started = false;       ///< The first window has been read
+  bool failed = false;
+  std::uint64_t line = 1;     ///< Physical line of the byte at pos
+  std::uint64_t row_line = 0; ///< Physical line of the last row read
+  std::size_t window_bytes = WINDOW_BYTES;
+  StructuralIndex index;
+  std::vector<std::string> column_names;
+
+  // Plain file input
+  int fd = -1;
+  std::uint64_t file_size = 0;
+  std::uint64_t file_offset = 0; ///< File offset of the window
+  void *mapping = nullptr;
+  std::size_t mapping_size = 0;
+
+  // Stream input
+  std::unique_ptr<std::streambuf> source;
+  std::vector<char> buffer;
+};
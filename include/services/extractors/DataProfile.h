@@ -0,0 +1,187 @@
+#pragma once
+
+#include "utils/HyperLogLog.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class ColumnProfile
+ * @brief Summary of the values of one CSV column, built while it is parsed.
+ *
+ * Counts values and nulls, estimates the distinct values with a HyperLogLog,
+ * tracks the minimum and maximum (numerically for numeric columns), buckets
+ * the value lengths by powers of two and counts the most frequent values.
+ *
+ * Values are counted in a Misra-Gries summary of MAX_TRACKED_VALUES
+ * counters. While a column has at most that many distinct values the counts
+ * and the distinct count are exact. Past that the column is treated as
+ * high-cardinality: the tracked values seed the estimate, and a value that
+ * finds no free counter lowers every count by one instead. Counts are then
+ * lower bounds, short by at most the number of such decrements, and every
+ * value more frequent than 1 / (MAX_TRACKED_VALUES + 1) of the column is
+ * still tracked. Profiles of the same column merge, so every extractor
+ * thread keeps its own and they are combined at the end.
+ */
+class ColumnProfile {
+public:
+  /** Counters of the frequent value summary, see the class comment */
+  static constexpr std::size_t MAX_TRACKED_VALUES = 1024;
+
+  /** Most frequent values listed in the report */
+  static constexpr std::size_t LISTED_VALUES = 50;
+
+  /** Length buckets: 0, 1, 2-3, 4-7, ..., 256 bytes and longer */
+  static constexpr std::size_t LENGTH_BUCKETS = 10;
+
+  explicit ColumnProfile(std::string name) : name(std::move(name)) {}
+
+  /** Column name in the CSV header */
+  const std::string &Name() const { return name; }
+
+  /** Records that the column was found in an input's header */
+  void MarkPresent() { present = true; }
+
+  /** Counts an empty optional value */
+  void AddNull() { ++nulls; }
+
+  /** Counts a text value */
+  void Add(std::string_view text);
+
+  /** Counts an integer value; its raw text is shown and measured */
+  void Add(std::string_view text, int number);
+
+  /** Counts a floating point value; its raw text is shown and measured */
+  void Add(std::string_view text, float number);
+
+  /** Adds the values counted by another profile of the same column */
+  void Merge(const ColumnProfile &other);
+
+  /** Writes the profile as a JSON object */
+  void WriteJson(std::ostream &out, const std::string &indent) const;
+
+private:
+  struct TrackedValue {
+    std::string text;
+    std::uint64_t hash;
+    std::uint64_t count;
+  };
+
+  /** Open-addressing slot of the tracked value table; hash 0 is empty */
+  struct Slot {
+    std::uint64_t hash;
+    std::uint32_t index; ///< Position in tracked
+  };
+
+  /** Counts a value in the distinct estimate, lengths and frequent values */
+  void count(std::string_view text, std::uint64_t hash);
+
+  /**
+   * @brief Adds occurrences of a value to its counter.
+   *
+   * @return false if the value is not tracked and no counter is free
+   */
+  bool track(std::uint64_t hash, std::string_view text, std::uint64_t count);
+
+  /** Adds the tracked values to the estimate once counts become inexact */
+  void stopExactCounting();
+
+  /**
+   * @brief Lowers every count by an amount and drops the counters that
+   * reach zero.
+   */
+  void decrement(std::uint64_t amount);
+
+  /** Rebuilds the hash table over tracked with a number of slots */
+  void rebuildSlots(std::size_t size);
+
+  /** Tracks the numeric extremes */
+  void addNumber(double number);
+
+  std::string name;
+  bool present = false;
+  bool numeric = false;          ///< Values were added as numbers
+  bool single_precision = false; ///< Numbers were floats
+  std::uint64_t values = 0;      ///< Non-null values
+  std::uint64_t nulls = 0;
+  HyperLogLog distinct;
+  std::array<std::uint64_t, LENGTH_BUCKETS> lengths{};
+
+  bool has_extremes = false;
+  double min_number = 0.0;
+  double max_number = 0.0;
+  std::string min_text;
+  std::string max_text;
+
+  bool exact = true; ///< False once more than MAX_TRACKED_VALUES are seen
+  std::uint64_t undercount = 0; ///< Most a tracked count is short by
+  std::vector<TrackedValue> tracked; ///< Counted values in order of arrival
+  std::vector<Slot> slots;           ///< Hash table over tracked
+};
+
+/**
+ * @class TableProfile
+ * @brief Column profiles of one CSV table, see ColumnProfile.
+ */
+class TableProfile {
+public:
+  /**
+   * @brief Creates empty profiles for the columns of a table.
+   *
+   * @param table Table name ("food_nutrient")
+   * @param columns Column names, in schema order
+   */
+  TableProfile(std::string table, const std::vector<std::string> &columns);
+
+  /** Table name */
+  const std::string &Table() const { return table; }
+
+  /** Profile of the column at a schema position */
+  ColumnProfile &Column(std::size_t index) { return columns[index]; }
+
+  /** Counts an accepted row */
+  void AddRow() { ++rows; }
+
+  /** Counts rows quarantined as malformed */
+  void AddRejected(std::size_t count) { rejected += count; }
+
+  /** Adds the rows counted by another profile of the same table */
+  void Merge(const TableProfile &other);
+
+  /** Writes the profile as a JSON object */
+  void WriteJson(std::ostream &out, const std::string &indent) const;
+
+private:
+  std::string table;
+  std::uint64_t rows = 0;
+  std::uint64_t rejected = 0;
+  std::vector<ColumnProfile> columns;
+};
+
+/**
+ * @class DataProfileReport
+ * @brief Profiles of every extracted table, written as one JSON document.
+ *
+ * Profiles of the same table, e.g. food_nutrient of several releases or
+ * of several extractor threads, are merged into one.
+ */
+class DataProfileReport {
+public:
+  /** Adds a table profile, merging it with an earlier one of the table */
+  void Add(const TableProfile &profile);
+
+  /**
+   * @brief Writes the report to a JSON file.
+   *
+   * @param path File to write
+   * @return false if the file cannot be written
+   */
+  bool WriteJson(const std::string &path) const;
+
+private:
+  std::vector<TableProfile> tables;
+};
@@ -0,0 +1,483 @@
+#pragma once
+
+#include "services/Profile.h"
+#include "services/extractors/CsvInput.h"
+#include "services/extractors/DataProfile.h"
+#include "services/extractors/FieldParser.h"
+#include "services/extractors/RejectSink.h"
+#include "services/extractors/Schema.h"
+#include "utils/Generator.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * @class Extractor
+ * @brief Extracts one USDA CSV table into a vector of models, driven by a
+ * compile-time schema (see CsvSchema).
+ *
+ * Column positions are resolved from the CSV header once per file, so
+ * releases that reorder or add columns are parsed correctly, and a release
+ * that drops a required column fails loudly instead of shifting values into
+ * the wrong members. The per-row loop is generated from the schema's field
+ * tuple, so every table shares the same exception-free parse kernel (see
+ * FieldParser) and the same reject handling (see RejectSink).
+ *
+ * Rows are either streamed in reusable batches (Stream()), for consumers
+ * that filter or aggregate in constant memory, or collected into one vector
+ * (TakeEntries()), which is built on the same stream. TakeEntries() can also
+ * profile the columns in the same pass (see EnableDataProfile()).
+ *
+ * @tparam Schema Schema descriptor of the table, e.g. USDA::FoodSchema
+ */
+template <typename Schema> class Extractor {
+public:
+  using Model = typename Schema::Model;
+
+  /** Default number of rows per streamed batch */
+  static constexpr std::size_t DEFAULT_BATCH_ROWS = 65536;
+
+  /**
+   * @class Batch
+   * @brief A reusable block of parsed rows, as yielded by Stream().
+   *
+   * The batch and its rows are reused for the next block, so the row
+   * objects and their strings keep their storage: once the first batch is
+   * filled, parsing further batches allocates only for values longer than
+   * any seen before in the same slot. Rows are valid until the stream is
+   * advanced; move them out to keep them.
+   */
+  class Batch {
+  public:
+    using iterator = typename std::vector<Model>::iterator;
+
+    iterator begin() { return rows.begin(); }
+    iterator end() { return rows.begin() + count; }
+
+    Model &operator[](std::size_t index) { return rows[index]; }
+
+    /** Number of rows in the batch */
+    std::size_t size() const { return count; }
+
+    /** True if the batch holds no rows */
+    bool empty() const { return count == 0; }
+
+  private:
+    friend class Extractor;
+
+    std::vector<Model> rows; ///< Row slots, reused across batches
+    std::size_t count = 0;   ///< Number of slots filled in this batch
+  };
+
+  /**
+   * @brief Constructs an extractor for the specified input file.
+   *
+   * @param input_file Input location of the table (see CsvInput)
+   * @param reject_directory Directory malformed rows are written to (see
+   *                         RejectSink)
+   * @param expected_rows Rows to reserve for TakeEntries(); the schema's
+   *                      estimate for the primary release
+   */
+  Extractor(const std::string &input_file,
+            std::string reject_directory = "rejects",
+            std::size_t expected_rows = Schema::expected_rows)
+      : input_file(input_file), reject_directory(std::move(reject_directory)),
+        expected_rows(expected_rows) {}
+  ~Extractor() = default;
+
+  Extractor(Extractor &&) = default;
+  Extractor &operator=(Extractor &&) = default;
+
+  /** Rows expected in the input, used to schedule the larger tables first */
+  std::size_t ExpectedRows() const { return expected_rows; }
+
+  /**
+   * @brief Restricts extraction to the tables and columns of a profile.
+   *
+   * A table outside the profile is not read at all. Excluded columns are
+   * never converted and stay empty in the models; required (non-optional)
+   * columns cannot be excluded and are still parsed.
+   *
+   * @param profile Profile selecting the materialized tables and columns
+   */
+  void ApplyProfile(const Profile &profile) {
+    enabled = profile.IncludesTable(Schema::table);
+    excluded_columns.clear();
+
+    for (const std::string &column : profile.ExcludedColumns(Schema::table)) {
+      bool found = false;
+      bool nullable = false;
+      std::apply(
+          [&](const auto &...field) {
+            ((column == field.name
+                  ? (found = true, nullable = field.nullable)
+                  : false),
+             ...);
+          },
+          Schema::fields);
+
+      if (!found) {
+        std::cerr << "Ignoring excluded column '" << column
+                  << "': not a column of " << label() << "\n";
+      } else if (!nullable) {
+        std::cerr << "Cannot exclude required column '" << column << "' of "
+                  << label() << "\n";
+      } else {
+        excluded_columns.insert(column);
+      }
+    }
+  }
+
+  /** Returns false if the table is not part of the applied profile */
+  bool Enabled() const { return enabled; }
+
+  /** Columns that are not materialized, as applied by ApplyProfile() */
+  const std::unordered_set<std::string> &ExcludedColumns() const {
+    return excluded_columns;
+  }
+
+  /**
+   * @brief Profiles the columns of the rows read by TakeEntries().
+   *
+   * Every accepted row is summarized in a TableProfile as it is parsed, so
+   * the profile costs no second pass over the input. The profile belongs to
+   * this extractor and is only updated by the thread running TakeEntries();
+   * profiles of the same table are merged by DataProfileReport.
+   */
+  void EnableDataProfile() {
+    std::vector<std::string> columns;
+    std::apply(
+        [&](const auto &...field) { (columns.push_back(field.name), ...); },
+        Schema::fields);
+    data_profile = std::make_unique<TableProfile>(Schema::table, columns);
+  }
+
+  /** Profile of the extracted rows, or nullptr if profiling is not enabled */
+  const TableProfile *DataProfile() const { return data_profile.get(); }
+
+  /**
+   * @brief Returns true if the last read of the input stopped early.
+   *
+   * Set by TakeEntries() and Stream() when the input cannot be opened, a
+   * required column is missing, or a read or decompression error ends the
+   * input before its last row. The rows read up to that point are still
+   * returned, so callers must check this before trusting them as the whole
+   * table. Only meaningful once all rows have been read.
+   */
+  bool Failed() const { return failed; }
+
+  /**
+   * @brief Parses the input file and hands over the extracted entries.
+   *
+   * Single-shot: the entries are moved out and the extractor keeps no copy,
+   * so each row exists exactly once in memory. Later calls return an empty
+   * vector without reading the file again.
+   *
+   * @return The extracted models
+   */
+  std::vector<Model> TakeEntries() {
+    if (taken) {
+      std::cerr << "Entries of " << label() << " input were already taken: "
+                << input_file << "\n";
+      return {};
+    }
+    taken = true;
+    return extractEntries();
+  }
+
+  /**
+   * @brief Streams the input as a lazily parsed sequence of row batches.
+   *
+   * Parsing happens as the caller iterates, so memory use stays at one
+   * batch whatever the input size, and the first rows are available as soon
+   * as the header and first batch are read. Malformed rows go to the
+   * reject sink as with TakeEntries(). The applied profile (see
+   * ApplyProfile()) is honored. Failed() reports an input that ended early
+   * once the stream is exhausted, so the extractor must outlive it.
+   *
+   * @code
+   * Extractor<USDA::FoodNutrientSchema> food_nutrients("food_nutrient.csv");
+   * for (auto &batch : food_nutrients.Stream()) {
+   *   for (USDA::FoodNutrient &row : batch) {
+   *     ...
+   *   }
+   * }
+   * @endcode
+   *
+   * @param batch_rows Maximum number of rows per batch
+   * @return Generator yielding each batch; batches are reused, so each is
+   *         valid until the next one is requested
+   */
+  Generator<Batch> Stream(std::size_t batch_rows = DEFAULT_BATCH_ROWS) {
+    return streamBatches(input_file, reject_directory, enabled,
+                         excluded_columns, batch_rows, nullptr, &failed);
+  }
+
+  /**
+   * @brief Streams an input file with every column, see Stream().
+   *
+   * @param input_file Input location of the table (see CsvInput)
+   * @param batch_rows Maximum number of rows per batch
+   * @param failed If given, set once the stream is exhausted to whether the
+   *        input ended early (see Failed())
+   */
+  static Generator<Batch> Stream(const std::string &input_file,
+                                 std::size_t batch_rows,
+                                 bool *failed = nullptr) {
+    return streamBatches(input_file, "rejects", true, {}, batch_rows,
+                         nullptr, failed);
+  }
+
+private:
+  static constexpr std::size_t FIELD_COUNT =
+      std::tuple_size_v<std::decay_t<decltype(Schema::fields)>>;
+  static constexpr std::size_t NOT_PRESENT =
+      std::numeric_limits<std::size_t>::max();
+
+  using ColumnIndices = std::array<std::size_t, FIELD_COUNT>;
+
+  /** Table name with spaces, as used in messages ("food nutrient") */
+  static std::string label() {
+    std::string label = Schema::table;
+    std::replace(label.begin(), label.end(), '_', ' ');
+    return label;
+  }
+
+  /**
+   * @brief Finds the column of every schema field in the CSV header.
+   *
+   * @return false if a required column is missing
+   */
+  static bool resolveColumns(const std::vector<std::string> &header,
+                             const std::unordered_set<std::string> &excluded,
+                             const std::string &input_file,
+                             ColumnIndices &columns) {
+    bool resolved = true;
+    std::size_t i = 0;
+
+    std::apply(
+        [&](const auto &...field) {
+          ((columns[i++] =
+                findColumn(header, field, excluded, input_file, resolved)),
+           ...);
+        },
+        Schema::fields);
+
+    return resolved;
+  }
+
+  template <typename Field>
+  static std::size_t findColumn(const std::vector<std::string> &header,
+                                const Field &field,
+                                const std::unordered_set<std::string> &excluded,
+                                const std::string &input_file,
+                                bool &resolved) {
+    // Excluded columns are treated as absent, so their bytes are never read
+    if (excluded.count(field.name)) {
+      return NOT_PRESENT;
+    }
+
+    const auto it = std::find(header.begin(), header.end(), field.name);
+    if (it != header.end()) {
+      return static_cast<std::size_t>(it - header.begin());
+    }
+    if (!Field::nullable) {
+      std::cerr << "Missing required column '" << field.name << "' in "
+                << label() << " input: " << input_file << "\n";
+      resolved = false;
+    }
+    return NOT_PRESENT;
+  }
+
+  /** Parses every schema field of one row into the entry */
+  template <std::size_t... I>
+  static void parseRow(FieldParser &fields, Model &entry,
+                       const ColumnIndices &columns,
+                       std::index_sequence<I...>) {
+    (parseField(std::get<I>(Schema::fields), fields, entry, columns[I]), ...);
+  }
+
+  template <typename Field>
+  static void parseField(const Field &field, FieldParser &fields,
+                         Model &entry, std::size_t column) {
+    if constexpr (Field::nullable) {
+      // Optional columns missing from this release stay empty
+      if (column == NOT_PRESENT) {
+        (entry.*field.member).reset();
+        return;
+      }
+    }
+    field.Parse(fields, column, entry);
+  }
+
+  /** Adds the schema fields of an accepted row to the profile */
+  template <std::size_t... I>
+  static void profileRow(TableProfile &profile, const CsvRow &row,
+                         const Model &entry, const ColumnIndices &columns,
+                         std::index_sequence<I...>) {
+    profile.AddRow();
+    (profileField(std::get<I>(Schema::fields), profile.Column(I), row, entry,
+                  columns[I]),
+     ...);
+  }
+
+  template <typename Field>
+  static void profileField(const Field &field, ColumnProfile &profile,
+                           const CsvRow &row, const Model &entry,
+                           std::size_t column) {
+    if (column == NOT_PRESENT) {
+      return;
+    }
+    const auto &value = entry.*field.member;
+    if constexpr (Field::nullable) {
+      if (!value) {
+        profile.AddNull();
+      } else {
+        profileValue(profile, row[column], *value);
+      }
+    } else {
+      profileValue(profile, row[column], value);
+    }
+  }
+
+  /** Numbers are profiled by value, everything else by its text */
+  template <typename T>
+  static void profileValue(ColumnProfile &profile, std::string_view text,
+                           const T &value) {
+    if constexpr (std::is_arithmetic_v<T>) {
+      profile.Add(text, value);
+    } else {
+      profile.Add(text);
+    }
+  }
+
+  /**
+   * @brief Parses the input in batches of batch_rows rows.
+   *
+   * The arguments are taken by value because they live in the coroutine
+   * frame for as long as the stream is iterated. Accepted rows are added to
+   * the profile, if one is given, and `failed` (if given) is set to whether
+   * the input ended early.
+   */
+  static Generator<Batch>
+  streamBatches(std::string input_file, std::string reject_directory,
+                bool enabled, std::unordered_set<std::string> excluded,
+                std::size_t batch_rows, TableProfile *profile, bool *failed) {
+    if (failed) {
+      *failed = false;
+    }
+    if (!enabled) {
+      co_return;
+    }
+
+    CsvInput input(input_file);
+    CsvReader &reader = input.Reader();
+
+    ColumnIndices columns;
+    if (!resolveColumns(reader.ColumnNames(), excluded, input_file,
+                        columns)) {
+      // An unreadable input has no header either
+      if (failed) {
+        *failed = true;
+      }
+      co_return;
+    }
+    if (profile) {
+      for (std::size_t i = 0; i < FIELD_COUNT; ++i) {
+        if (columns[i] != NOT_PRESENT) {
+          profile->Column(i).MarkPresent();
+        }
+      }
+    }
+
+    RejectSink rejects(Schema::table, reject_directory);
+
+    Batch batch;
+    batch.rows.resize(std::max<std::size_t>(batch_rows, 1));
+
+    CsvRow row;
+    while (reader.ReadRow(row)) {
+      FieldParser fields(row);
+      Model &entry = batch.rows[batch.count];
+
+      parseRow(fields, entry, columns, std::make_index_sequence<FIELD_COUNT>{});
+
+      if (fields.Skipped()) {
+        continue;
+      }
+      if (!fields.Ok()) {
+        rejects.Reject(reader.Line(), fields);
+        continue;
+      }
+      if (profile) {
+        profileRow(*profile, row, entry, columns,
+                   std::make_index_sequence<FIELD_COUNT>{});
+      }
+
+      if (++batch.count == batch.rows.size()) {
+        co_yield batch;
+        batch.count = 0;
+      }
+    }
+
+    if (batch.count > 0) {
+      co_yield batch;
+    }
+
+    rejects.Finish();
+    if (profile) {
+      profile->AddRejected(rejects.Count());
+    }
+
+    // The rows read so far are kept, but the table is incomplete
+    if (input.Failed()) {
+      std::cerr << "Failed to read " << label() << " input: " << input_file
+                << "\n";
+      if (failed) {
+        *failed = true;
+      }
+    }
+  }
+
+  /** Parses the input file into a new vector of entries */
+  std::vector<Model> extractEntries() {
+    std::vector<Model> entries;
+    if (!enabled) {
+      return entries;
+    }
+
+    // Pre-allocate to avoid frequent reallocations during parsing
+    entries.reserve(expected_rows);
+
+    for (Batch &batch :
+         streamBatches(input_file, reject_directory, enabled,
+                       excluded_columns, DEFAULT_BATCH_ROWS,
+                       data_profile.get(), &failed)) {
+      std::move(batch.begin(), batch.end(), std::back_inserter(entries));
+    }
+
+    // Optimize memory usage after loading is complete
+    entries.shrink_to_fit();
+    return entries;
+  }
+
+  std::string input_file;       ///< Input location of the table
+  std::string reject_directory; ///< Where malformed rows are quarantined
+  std::size_t expected_rows;    ///< Rows reserved by TakeEntries()
+  bool taken = false;  ///< True once TakeEntries() has handed out entries
+  bool enabled = true; ///< False if the profile leaves the table out
+  bool failed = false; ///< The last read stopped early, see Failed()
+  std::unordered_set<std::string> excluded_columns; ///< Unconverted columns
+  std::unique_ptr<TableProfile> data_profile; ///< Set by EnableDataProfile()
+};
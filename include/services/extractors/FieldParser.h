@@ -0,0 +1,120 @@
+#pragma once
+
+#include "services/extractors/CsvReader.h"
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * @class FieldParser
+ * @brief Parses the fields of one CSV row without throwing.
+ *
+ * Each Parse() call converts one column into the given output. The first
+ * failure is remembered (column, reason and raw value) and turns every later
+ * call into a no-op, so an extractor parses all columns unconditionally and
+ * checks Ok() once per row. A malformed row therefore costs about as much as a
+ * valid one, instead of unwinding an exception.
+ *
+ * Numeric fields follow the csv-parser rules they replace: surrounding
+ * whitespace is ignored and an all-whitespace field is empty (null).
+ */
+class FieldParser {
+public:
+  /** Why a field could not be parsed */
+  enum class Failure {
+    None,
+    MissingColumn, ///< The row has fewer columns than expected
+    EmptyValue,    ///< A required field is empty
+    InvalidInteger,
+    InvalidNumber,
+    InvalidDate
+  };
+
+  /**
+   * @brief Prepares to parse the given row.
+   *
+   * @param row Row to parse; must outlive the parser
+   */
+  explicit FieldParser(const CsvRow &row) : row(row) {}
+
+  /** Parses a required integer column */
+  void Parse(std::size_t column, int &out);
+
+  /** Parses a required floating point column */
+  void Parse(std::size_t column, float &out);
+
+  /** Copies a text column as is; an empty field yields an empty string */
+  void Parse(std::size_t column, std::string &out);
+
+  /** Parses a required ISO date (YYYY-MM-DD...) column */
+  void Parse(std::size_t column, std::chrono::year_month_day &out);
+
+  /** Parses an optional integer column; empty fields yield std::nullopt */
+  void Parse(std::size_t column, std::optional<int> &out);
+
+  /** Parses an optional floating point column; empty fields yield std::nullopt */
+  void Parse(std::size_t column, std::optional<float> &out);
+
+  /** Copies an optional text column; empty fields yield std::nullopt */
+  void Parse(std::size_t column, std::optional<std::string> &out);
+
+  /**
+   * @brief Parses an optional ISO date column leniently.
+   *
+   * Empty and malformed dates both yield std::nullopt and never fail the row.
+   */
+  void Parse(std::size_t column,
+             std::optional<std::chrono::year_month_day> &out);
+
+  /**
+   * @brief Returns the raw text of a column without copying.
+   *
+   * A missing column fails the row and yields an empty view.
+   */
+  std::string_view View(std::size_t column);
+
+  /**
+   * @brief Drops the row without rejecting it (e.g. an excluded data type).
+   *
+   * Later Parse() calls become no-ops.
+   */
+  void Skip() { skipped = true; }
+
+  /** Returns true if the row was dropped with Skip() */
+  bool Skipped() const { return skipped; }
+
+  /** Returns true while no field has failed */
+  bool Ok() const { return failure == Failure::None; }
+
+  /** Column of the first failure */
+  std::size_t FailedColumn() const { return failed_column; }
+
+  /** Reason for the first failure */
+  Failure FailureReason() const { return failure; }
+
+  /** Raw text of the field that failed first */
+  std::string_view FailedValue() const { return failed_value; }
+
+  /** Returns a short description of a failure reason */
+  static const char *Describe(Failure failure);
+
+private:
+  /**
+   * @brief Fetches a column, or records a missing column.
+   *
+   * @return false if the row has already failed or been skipped, or the
+   *         column is missing
+   */
+  bool field(std::size_t column, std::string_view &value);
+
+  /** Records the first failure of the row */
+  void fail(std::size_t column, Failure reason, std::string_view value);
+
+  const CsvRow &row;
+  Failure failure = Failure::None;
+  bool skipped = false;
+  std::size_t failed_column = 0;
+  std::string_view failed_value;
+};
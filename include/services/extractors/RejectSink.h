@@ -0,0 +1,72 @@
+#pragma once
+
+#include "services/extractors/FieldParser.h"
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+/**
+ * @class RejectSink
+ * @brief Quarantines rows an extractor could not parse.
+ *
+ * Every rejected row is counted and appended to `<directory>/<table>.csv` with
+ * its line, column, reason and raw value. Writes are buffered and the file is
+ * only created once the first row is rejected, so clean inputs leave no
+ * trace. Only the first few rejects of a table are logged to std::cerr; the
+ * rest are summarized by Finish().
+ *
+ * Lines are the 1-based physical lines the rows start on, with the header on
+ * line 1, as reported by CsvReader::Line().
+ *
+ * Each sink is used by a single extractor thread.
+ */
+class RejectSink {
+public:
+  /**
+   * @brief Creates a sink for one input table.
+   *
+   * @param table Table name, used for the file name ("food_nutrient")
+   * @param directory Directory the reject files are written to
+   */
+  RejectSink(std::string table, std::string directory = "rejects");
+
+  /** Flushes buffered rejects */
+  ~RejectSink();
+
+  RejectSink(const RejectSink &) = delete;
+  RejectSink &operator=(const RejectSink &) = delete;
+
+  /**
+   * @brief Records a rejected row.
+   *
+   * @param line Line of the row in the input
+   * @param column Column that failed
+   * @param reason Short description of the failure
+   * @param value Raw field value
+   */
+  void Reject(std::size_t line, std::size_t column, std::string_view reason,
+              std::string_view value);
+
+  /** Records the first failure of a parsed row */
+  void Reject(std::size_t line, const FieldParser &fields);
+
+  /** Number of rows rejected so far */
+  std::size_t Count() const { return count; }
+
+  /** Flushes the reject file and reports the number of rejected rows */
+  void Finish();
+
+private:
+  /** Writes the buffered rows to the reject file */
+  void flush();
+
+  std::string table;
+  std::string directory;
+  std::string path;
+  std::string label; ///< Table name as shown in log messages
+  std::size_t count = 0;
+  std::string buffer;
+  std::ofstream file;
+  bool file_failed = false;
+};
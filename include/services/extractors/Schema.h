@@ -0,0 +1,74 @@
+#pragma once
+
+#include "services/extractors/FieldParser.h"
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+/**
+ * @namespace CsvSchema
+ * @brief Compile-time descriptions of how CSV columns map onto model members.
+ *
+ * A schema is a struct with:
+ * - `Model`: the model type produced for every row
+ * - `table`: table name ("food_nutrient"), used for rejects and messages
+ * - `expected_rows`: typical row count, used to pre-allocate
+ * - `fields`: a tuple of CsvSchema::Field descriptors
+ *
+ * Fields are matched to CSV columns by header name, so their order in the
+ * schema does not have to follow the file. A field is nullable when its
+ * member is a std::optional; nullable columns may be absent from the header,
+ * required columns may not.
+ */
+namespace CsvSchema {
+
+template <typename T> struct IsOptional : std::false_type {};
+template <typename T> struct IsOptional<std::optional<T>> : std::true_type {};
+
+/**
+ * @struct Field
+ * @brief Maps one CSV column onto a model member.
+ *
+ * Values are converted with the matching FieldParser::Parse() overload unless
+ * a custom parse function is given. Member types without such an overload
+ * (enums, for example) need a custom parse function.
+ */
+template <typename Model, typename T> struct Field {
+  using ModelType = Model;
+  using ValueType = T;
+
+  /** Custom conversion of a column into the member */
+  using ParseFunction = void (*)(FieldParser &fields, std::size_t column,
+                                 T &out);
+
+  static constexpr bool nullable = IsOptional<T>::value;
+
+  const char *name;                ///< Column name in the CSV header
+  T Model::*member;                ///< Member receiving the value
+  ParseFunction parse = nullptr;   ///< Optional custom conversion
+
+  /** Parses the column into the member of the given entry */
+  void Parse(FieldParser &fields, std::size_t column, Model &entry) const {
+    if (parse) {
+      parse(fields, column, entry.*member);
+    } else if constexpr (requires(T &value) { fields.Parse(column, value); }) {
+      fields.Parse(column, entry.*member);
+    }
+  }
+};
+
+/** Describes a column parsed with the default conversion for its type */
+template <typename Model, typename T>
+constexpr Field<Model, T> Column(const char *name, T Model::*member) {
+  return {name, member, nullptr};
+}
+
+/** Describes a column parsed with a custom conversion */
+template <typename Model, typename T>
+constexpr Field<Model, T>
+Column(const char *name, T Model::*member,
+       typename Field<Model, T>::ParseFunction parse) {
+  return {name, member, parse};
+}
+
+} // namespace CsvSchema
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "models/usda/BrandedFood.h"
+#include "services/extractors/Schema.h"
+#include <tuple>
+
+namespace USDA {
+
+/**
+ * @struct BrandedFoodSchema
+ * @brief Column layout of branded_food.csv.
+ *
+ * Branded foods are commercially available products with brand names,
+ * ingredients, serving sizes and other brand-specific attributes. Malformed
+ * dates are treated as missing rather than rejecting the product.
+ */
+struct BrandedFoodSchema {
+  using Model = BrandedFood;
+  static constexpr const char *table = "branded_food";
+  static constexpr std::size_t expected_rows = 2000000;
+
+  static constexpr auto fields = std::make_tuple(
+      CsvSchema::Column("fdc_id", &BrandedFood::fdc_id),
+      CsvSchema::Column("brand_owner", &BrandedFood::brand_owner),
+      CsvSchema::Column("brand_name", &BrandedFood::brand_name),
+      CsvSchema::Column("subbrand_name", &BrandedFood::subbrand_name),
+      CsvSchema::Column("gtin_upc", &BrandedFood::gtin_upc),
+      CsvSchema::Column("ingredients", &BrandedFood::ingredients),
+      CsvSchema::Column("not_a_significant_source_of",
+                        &BrandedFood::not_a_significant_source_of),
+      CsvSchema::Column("serving_size", &BrandedFood::serving_size),
+      CsvSchema::Column("serving_size_unit", &BrandedFood::serving_size_unit),
+      CsvSchema::Column("household_serving_fulltext",
+                        &BrandedFood::household_serving_fulltext),
+      CsvSchema::Column("branded_food_category",
+                        &BrandedFood::branded_food_category),
+      CsvSchema::Column("data_source", &BrandedFood::data_source),
+      CsvSchema::Column("package_weight", &BrandedFood::package_weight),
+      CsvSchema::Column("modified_date", &BrandedFood::modified_date),
+      CsvSchema::Column("available_date", &BrandedFood::available_date),
+      CsvSchema::Column("market_country", &BrandedFood::market_country),
+      CsvSchema::Column("discontinued_date", &BrandedFood::discontinued_date),
+      CsvSchema::Column("preparation_state_code",
+                        &BrandedFood::preparation_state_code),
+      CsvSchema::Column("trade_channel", &BrandedFood::trade_channel),
+      CsvSchema::Column("short_description", &BrandedFood::short_description),
+      CsvSchema::Column("material_code", &BrandedFood::material_code));
+};
+
+} // namespace USDA
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "models/usda/FoodAttribute.h"
+#include "services/extractors/Schema.h"
+#include <tuple>
+
+namespace USDA {
+
+/**
+ * @struct FoodAttributeSchema
+ * @brief Column layout of food_attribute.csv.
+ *
+ * Food attributes attach free-form name/value details (common names,
+ * adjustments, additional descriptions) to Foundation and Survey foods.
+ */
+struct FoodAttributeSchema {
+  using Model = FoodAttribute;
+  static constexpr const char *table = "food_attribute";
+  static constexpr std::size_t expected_rows = 50000;
+
+  static constexpr auto fields = std::make_tuple(
+      CsvSchema::Column("id", &FoodAttribute::id),
+      CsvSchema::Column("fdc_id", &FoodAttribute::fdc_id),
+      CsvSchema::Column("seq_num", &FoodAttribute::seq_num),
+      CsvSchema::Column("food_attribute_type_id",
+                        &FoodAttribute::food_attribute_type_id),
+      CsvSchema::Column("name", &FoodAttribute::name),
+      CsvSchema::Column("value", &FoodAttribute::value));
+};
+
+} // namespace USDA
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "models/usda/FoodCategory.h"
+#include "services/extractors/Schema.h"
+#include <tuple>
+
+namespace USDA {
+
+/**
+ * @struct FoodCategorySchema
+ * @brief Column layout of food_category.csv.
+ *
+ * Food categories define the taxonomic groupings of food items.
+ */
+struct FoodCategorySchema {
+  using Model = FoodCategory;
+  static constexpr const char *table = "food_category";
+  static constexpr std::size_t expected_rows = 50;
+
+  static constexpr auto fields = std::make_tuple(
+      CsvSchema::Column("id", &FoodCategory::id),
+      CsvSchema::Column("code", &FoodCategory::code),
+      CsvSchema::Column("description", &FoodCategory::description));
+};
+
+} // namespace USDA
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "models/usda/FoodNutrient.h"
+#include "services/extractors/Schema.h"
+#include <tuple>
+
+namespace USDA {
+
+/**
+ * @struct FoodNutrientSchema
+ * @brief Column layout of food_nutrient.csv.
+ *
+ * Each row links a food to a nutrient and its amount. This is by far the
+ * largest table, typically with ~28 million rows.
+ */
+struct FoodNutrientSchema {
+  using Model = FoodNutrient;
+  static constexpr const char *table = "food_nutrient";
+  static constexpr std::size_t expected_rows = 28000000;
+
+  static constexpr auto fields = std::make_tuple(
+      CsvSchema::Column("id", &FoodNutrient::id),
+      CsvSchema::Column("fdc_id", &FoodNutrient::fdc_id),
+      CsvSchema::Column("nutrient_id", &FoodNutrient::nutrient_id),
+      CsvSchema::Column("amount", &FoodNutrient::amount),
+      CsvSchema::Column("data_points", &FoodNutrient::data_points),
+      CsvSchema::Column("derivation_id", &FoodNutrient::derivation_id),
+      CsvSchema::Column("min", &FoodNutrient::min),
+      CsvSchema::Column("max", &FoodNutrient::max),
+      CsvSchema::Column("median", &FoodNutrient::median),
+      CsvSchema::Column("loq", &FoodNutrient::loq),
+      CsvSchema::Column("footnote", &FoodNutrient::footnote),
+      CsvSchema::Column("min_year_acquired",
+                        &FoodNutrient::min_year_acquired),
+      CsvSchema::Column("percent_daily_value",
+                        &FoodNutrient::percent_daily_value));
+};
+
+} // namespace USDA
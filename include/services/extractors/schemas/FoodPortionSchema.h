@@ -0,0 +1,46 @@
+#pragma once
+
+#include "models/usda/FoodPortion.h"
+#include "services/extractors/Schema.h"
+#include <tuple>
+
+namespace USDA {
+
+/**
+ * @struct FoodPortionSchema
+ * @brief Column layout of food_portion.csv.
+ *
+ * Food portions define serving sizes and household measures together with
+ * their gram weights.
+ */
+struct FoodPortionSchema {
+  using Model = FoodPortion;
+  static constexpr const char *table = "food_portion";
+  static constexpr std::size_t expected_rows = 50000;
+
+  /** Keeps the portion description even when it is empty */
+  static void ParseDescription(FieldParser &fields, std::size_t column,
+                               std::optional<std::string> &out) {
+    if (!out) {
+      out.emplace();
+    }
+    fields.Parse(column, *out);
+  }
+
+  static constexpr auto fields = std::make_tuple(
+      CsvSchema::Column("id", &FoodPortion::id),
+      CsvSchema::Column("fdc_id", &FoodPortion::fdc_id),
+      CsvSchema::Column("seq_num", &FoodPortion::seq_num),
+      CsvSchema::Column("amount", &FoodPortion::amount),
+      CsvSchema::Column("measure_unit_id", &FoodPortion::measure_unit_id),
+      CsvSchema::Column("portion_description",
+                        &FoodPortion::portion_description, &ParseDescription),
+      CsvSchema::Column("modifier", &FoodPortion::modifier),
+      CsvSchema::Column("gram_weight", &FoodPortion::gram_weight),
+      CsvSchema::Column("data_points", &FoodPortion::data_points),
+      CsvSchema::Column("footnote", &FoodPortion::footnote),
+      CsvSchema::Column("min_year_acquired",
+                        &FoodPortion::min_year_acquired));
+};
+
+} // namespace USDA
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "models/usda/Food.h"
+#include "services/extractors/Schema.h"
+#include <tuple>
+
+namespace USDA {
+
+/**
+ * @struct FoodSchema
+ * @brief Column layout of food.csv.
+ *
+ * Foundation, branded, SR Legacy and Survey (FNDDS) foods are kept; other
+ * food types such as sample foods and sub-sample foods are skipped without
+ * being rejected. Which of the kept types a release contributes is decided
+ * when the releases are merged (see DatasetMergeTransformer).
+ */
+struct FoodSchema {
+  using Model = Food;
+  static constexpr const char *table = "food";
+  static constexpr std::size_t expected_rows = 2000000;
+
+  /** Maps data_type onto FoodDataType, skipping excluded food types */
+  static void ParseDataType(FieldParser &fields, std::size_t column,
+                            FoodDataType &out) {
+    const std::string_view data_type = fields.View(column);
+    if (data_type == "foundation_food") {
+      out = FoodDataType::Foundation;
+    } else if (data_type == "branded_food") {
+      out = FoodDataType::Branded;
+    } else if (data_type == "sr_legacy_food") {
+      out = FoodDataType::SrLegacy;
+    } else if (data_type == "survey_fndds_food") {
+      out = FoodDataType::Survey;
+    } else if (fields.Ok()) {
+      fields.Skip();
+    }
+  }
+
+  // The data type comes first so that excluded rows stop parsing early
+  static constexpr auto fields = std::make_tuple(
+      CsvSchema::Column("data_type", &Food::data_type, &ParseDataType),
+      CsvSchema::Column("fdc_id", &Food::fdc_id),
+      CsvSchema::Column("description", &Food::description),
+      CsvSchema::Column("food_category_id", &Food::food_category_id),
+      CsvSchema::Column("publication_date", &Food::publication_date));
+};
+
+} // namespace USDA
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "models/usda/InputFood.h"
+#include "services/extractors/Schema.h"
+#include <tuple>
+
+namespace USDA {
+
+/**
+ * @struct InputFoodSchema
+ * @brief Column layout of input_food.csv.
+ *
+ * Input foods list the ingredient foods that Foundation and Survey (FNDDS)
+ * foods are composed or derived from.
+ */
+struct InputFoodSchema {
+  using Model = InputFood;
+  static constexpr const char *table = "input_food";
+  static constexpr std::size_t expected_rows = 100000;
+
+  static constexpr auto fields = std::make_tuple(
+      CsvSchema::Column("id", &InputFood::id),
+      CsvSchema::Column("fdc_id", &InputFood::fdc_id),
+      CsvSchema::Column("fdc_id_of_input_food",
+                        &InputFood::fdc_id_of_input_food),
+      CsvSchema::Column("seq_num", &InputFood::seq_num),
+      CsvSchema::Column("amount", &InputFood::amount),
+      CsvSchema::Column("sr_code", &InputFood::sr_code),
+      CsvSchema::Column("sr_description", &InputFood::sr_description),
+      CsvSchema::Column("unit", &InputFood::unit),
+      CsvSchema::Column("portion_code", &InputFood::portion_code),
+      CsvSchema::Column("portion_description",
+                        &InputFood::portion_description),
+      CsvSchema::Column("gram_weight", &InputFood::gram_weight),
+      CsvSchema::Column("retention_code", &InputFood::retention_code));
+};
+
+} // namespace USDA
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "models/usda/MeasureUnit.h"
+#include "services/extractors/Schema.h"
+#include <tuple>
+
+namespace USDA {
+
+/**
+ * @struct MeasureUnitSchema
+ * @brief Column layout of measure_unit.csv.
+ *
+ * Measure units (cup, tbsp, g, ...) are referenced by food portions.
+ */
+struct MeasureUnitSchema {
+  using Model = MeasureUnit;
+  static constexpr const char *table = "measure_unit";
+  static constexpr std::size_t expected_rows = 150;
+
+  static constexpr auto fields =
+      std::make_tuple(CsvSchema::Column("id", &MeasureUnit::id),
+                      CsvSchema::Column("name", &MeasureUnit::name));
+};
+
+} // namespace USDA
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "models/usda/Nutrient.h"
+#include "services/extractors/Schema.h"
+#include <tuple>
+
+namespace USDA {
+
+/**
+ * @struct NutrientSchema
+ * @brief Column layout of nutrient.csv.
+ *
+ * Nutrients (vitamins, minerals, macronutrients, ...) are the reference data
+ * for food nutrient values.
+ */
+struct NutrientSchema {
+  using Model = Nutrient;
+  static constexpr const char *table = "nutrient";
+  static constexpr std::size_t expected_rows = 500;
+
+  /** Reads the rank, which releases write as a decimal ("500.0") */
+  static void ParseRank(FieldParser &fields, std::size_t column,
+                        std::optional<int> &out) {
+    std::optional<float> rank;
+    fields.Parse(column, rank);
+    out = rank ? std::make_optional(static_cast<int>(*rank)) : std::nullopt;
+  }
+
+  static constexpr auto fields = std::make_tuple(
+      CsvSchema::Column("id", &Nutrient::id),
+      CsvSchema::Column("name", &Nutrient::name),
+      CsvSchema::Column("unit_name", &Nutrient::unit_name),
+      CsvSchema::Column("nutrient_nbr", &Nutrient::nutrient_nbr),
+      CsvSchema::Column("rank", &Nutrient::rank, &ParseRank));
+};
+
+} // namespace USDA
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "models/usda/SurveyFnddsFood.h"
+#include "services/extractors/Schema.h"
+#include <tuple>
+
+namespace USDA {
+
+/**
+ * @struct SurveyFnddsFoodSchema
+ * @brief Column layout of survey_fndds_food.csv.
+ *
+ * Links each Survey (FNDDS) food to its FNDDS food code and WWEIA category
+ * for the survey period it belongs to.
+ */
+struct SurveyFnddsFoodSchema {
+  using Model = SurveyFnddsFood;
+  static constexpr const char *table = "survey_fndds_food";
+  static constexpr std::size_t expected_rows = 10000;
+
+  static constexpr auto fields = std::make_tuple(
+      CsvSchema::Column("fdc_id", &SurveyFnddsFood::fdc_id),
+      CsvSchema::Column("food_code", &SurveyFnddsFood::food_code),
+      CsvSchema::Column("wweia_category_code",
+                        &SurveyFnddsFood::wweia_category_code),
+      CsvSchema::Column("start_date", &SurveyFnddsFood::start_date),
+      CsvSchema::Column("end_date", &SurveyFnddsFood::end_date));
+};
+
+} // namespace USDA
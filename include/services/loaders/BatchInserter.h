@@ -0,0 +1,164 @@
+#pragma once
+
+#include "sqlite/sqlite3.h"
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @class BatchInserter
+ * @brief Inserts rows into one table with multi-row INSERT statements.
+ *
+ * Rows are bound into an `INSERT ... VALUES (...),(...),...` statement
+ * holding K rows, and the statement is stepped once per K rows. K is the
+ * largest row count whose parameters fit the connection's variable limit
+ * (SQLITE_LIMIT_VARIABLE_NUMBER), capped at MAX_ROWS_PER_STATEMENT. The
+ * remaining rows, fewer than K, are written with a statement sized exactly for
+ * them, so a table needs at most two prepared statements.
+ *
+ * Columns can be excluded from the insert (see SQLiteLoaderService::
+ * ExcludeColumns()): their values are still passed to Row::Bind() in column
+ * order, but are not bound, so callers bind every row the same way whatever
+ * the projection.
+ *
+ * Values are bound without copying: strings must stay alive until their batch
+ * is stepped, which is the case for rows bound straight from the model
+ * vectors. Values formatted on the fly (dates, for example) go into the row's
+ * Scratch() storage, which lives as long as the batch.
+ */
+class BatchInserter {
+public:
+  /** Upper bound on the rows bound into one statement */
+  static constexpr std::size_t MAX_ROWS_PER_STATEMENT = 512;
+
+  /** Scratch bytes available to each row */
+  static constexpr std::size_t SCRATCH_BYTES_PER_ROW = 64;
+
+  /**
+   * @class Row
+   * @brief Binds the values of one row, column by column, in insert order.
+   *
+   * Every Bind call consumes one column; values of excluded columns are
+   * skipped.
+   */
+  class Row {
+  public:
+    void Bind(int value);
+    void Bind(sqlite3_int64 value);
+    void Bind(double value);
+
+    /** Binds a string without copying it */
+    void Bind(const std::string &value);
+
+    /** Binds a static C string without copying it; nullptr binds NULL */
+    void Bind(const char *value);
+
+    /** Binds the contained value, or NULL */
+    template <typename T> void Bind(const std::optional<T> &value) {
+      if (value) {
+        Bind(*value);
+      } else {
+        BindNull();
+      }
+    }
+
+    void BindNull();
+
+    /**
+     * @brief Binds text of the given length without copying it.
+     *
+     * @param value Text that stays alive until the batch is stepped
+     * @param length Length of the text in bytes
+     */
+    void BindText(const char *value, int length);
+
+    /** Binds a copy of text that does not outlive the call */
+    void BindTextCopy(const char *value, int length);
+
+    /**
+     * @brief Returns storage that lives until the row's batch is stepped.
+     *
+     * @param size Number of bytes needed
+     * @return Pointer to the storage, or nullptr if the row's scratch space
+     *         (SCRATCH_BYTES_PER_ROW) is used up
+     */
+    char *Scratch(std::size_t size);
+
+  private:
+    friend class BatchInserter;
+    Row(sqlite3_stmt *stmt, int index, char *scratch,
+        const std::vector<char> &included)
+        : stmt(stmt), index(index), scratch(scratch), included(included) {}
+
+    /** Advances to the next column; returns false if it is excluded */
+    bool nextColumn() { return included[column++]; }
+
+    sqlite3_stmt *stmt;
+    int index;               ///< Next parameter to bind
+    char *scratch;           ///< Unused part of the row's scratch space
+    std::size_t scratchUsed = 0;
+    const std::vector<char> &included; ///< Per column: bound or skipped
+    std::size_t column = 0;  ///< Next column to bind
+  };
+
+  /**
+   * @brief Prepares the multi-row insert statement.
+   *
+   * @param db Open database connection
+   * @param table Table to insert into
+   * @param columns Columns bound for every row, in binding order
+   * @param totalRows Number of rows that will be inserted
+   * @param excluded Columns left out of the insert
+   */
+  BatchInserter(sqlite3 *db, const std::string &table,
+                const std::vector<std::string> &columns,
+                std::size_t totalRows,
+                const std::unordered_set<std::string> &excluded = {});
+
+  /** Finalizes the prepared statements */
+  ~BatchInserter();
+
+  BatchInserter(const BatchInserter &) = delete;
+  BatchInserter &operator=(const BatchInserter &) = delete;
+
+  /** Returns false if the insert statement could not be prepared */
+  bool Ok() const { return stmt != nullptr; }
+
+  /** Starts the next row and returns its binder */
+  Row NextRow();
+
+  /**
+   * @brief Completes the current row, stepping the statement once its batch
+   * is full.
+   *
+   * @return false if inserting the batch failed
+   */
+  bool EndRow();
+
+  /** Number of rows bound but not yet inserted */
+  std::size_t PendingRows() const { return pending; }
+
+  /** Number of rows inserted by each full statement */
+  std::size_t RowsPerStatement() const { return rowsPerStatement; }
+
+private:
+  /** Prepares an insert statement for the given number of rows */
+  sqlite3_stmt *prepare(std::size_t rows) const;
+
+  sqlite3 *db;
+  std::string table;
+  std::vector<std::string> columns; ///< Inserted columns
+  std::vector<char> included;       ///< Per bound column: inserted or not
+  std::size_t remaining;        ///< Rows not yet started
+  std::size_t rowsPerStatement; ///< K, rows in the full statement
+  std::size_t batchRows;        ///< Rows in the statement currently in use
+  std::size_t pending = 0;      ///< Rows bound into the current batch
+
+  sqlite3_stmt *stmt = nullptr;     ///< Full K-row statement
+  sqlite3_stmt *tailStmt = nullptr; ///< Statement for the final rows
+  sqlite3_stmt *current = nullptr;  ///< Statement being bound
+
+  std::vector<char> scratch; ///< SCRATCH_BYTES_PER_ROW bytes per batch row
+};
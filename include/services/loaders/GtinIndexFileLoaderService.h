@@ -0,0 +1,56 @@
+#pragma once
+
+/**
+ * @file GtinIndexFileLoaderService.h
+ * @brief Service for writing the GTIN index as a standalone memory-mappable
+ * file
+ *
+ * The file is laid out so that a reader can mmap it and search it in place
+ * without any parsing step:
+ *
+ * | Offset            | Size          | Contents                              |
+ * |-------------------|---------------|---------------------------------------|
+ * | 0                 | 8             | Magic bytes "USDAGTIN"                |
+ * | 8                 | 4             | Format version (uint32, currently 1)  |
+ * | 12                | 4             | Reserved, zero                        |
+ * | 16                | 8             | Entry count N (uint64)                |
+ * | 24                | 40            | Padding, zero                         |
+ * | 64                | 8 * N         | GTINs, ascending (uint64)             |
+ * | 64 + 8 * N        | 4 * N         | FDC IDs, parallel to the GTINs (int32)|
+ *
+ * All integers are stored in host byte order. Keys and values are kept in
+ * separate arrays so that a binary search only touches the key array.
+ */
+
+#include "models/usda/GtinIndexEntry.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GtinIndexFileLoaderService {
+public:
+  /** Current on-disk format version */
+  static constexpr std::uint32_t FORMAT_VERSION = 1;
+
+  /** Byte offset of the GTIN array; the header is padded to a cache line */
+  static constexpr std::uint64_t HEADER_SIZE = 64;
+
+  /**
+   * @brief Constructs a GtinIndexFileLoaderService with the output file path
+   *
+   * @param filePath Path of the index file (will be replaced if it exists)
+   */
+  GtinIndexFileLoaderService(const std::string &filePath);
+  ~GtinIndexFileLoaderService() = default;
+
+  /**
+   * @brief Writes the sorted GTIN index to the output file
+   *
+   * @param gtin_index_entries Index entries sorted by GTIN
+   * @return true if the file was written completely, false otherwise
+   */
+  bool LoadGtinIndex(const std::vector<USDA::GtinIndexEntry> &gtin_index_entries);
+
+private:
+  std::string filePath; ///< Path of the index file
+};
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "models/usda/Food.h"
+#include "sqlite/sqlite3.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @class MemoryTable
+ * @brief Read-only view of one extracted table, as exposed by
+ * MemoryTableModule.
+ *
+ * Rows are read straight from the model vector, so the vector must outlive
+ * every statement that reads the table and must not change meanwhile.
+ */
+class MemoryTable {
+public:
+  virtual ~MemoryTable() = default;
+
+  /** Table name ("food_nutrient") */
+  virtual const char *Name() const = 0;
+
+  /** CREATE TABLE statement declaring the columns to SQLite */
+  virtual std::string Declaration() const = 0;
+
+  /** Number of rows */
+  virtual std::size_t Size() const = 0;
+
+  /** Position of the fdc_id column, or -1 if the table has none */
+  virtual int FdcIdColumn() const = 0;
+
+  /** fdc_id of a row; only valid if FdcIdColumn() is not -1 */
+  virtual int FdcId(std::size_t row) const = 0;
+
+  /** Sets the value of one column of a row as the SQL function result */
+  virtual void Result(sqlite3_context *context, std::size_t row,
+                      int column) const = 0;
+
+  /**
+   * @brief Rows in fdc_id order, built on first use.
+   *
+   * Extracted tables are usually already ordered by fdc_id; then no index is
+   * needed and nullptr is returned, meaning row i is at position i.
+   * Otherwise the row positions are sorted once (stably, by fdc_id) and
+   * kept for later queries.
+   */
+  const std::vector<std::uint32_t> *FdcIdOrder();
+
+protected:
+  static void Result(sqlite3_context *context, int value);
+  static void Result(sqlite3_context *context, float value);
+  static void Result(sqlite3_context *context, double value);
+  static void Result(sqlite3_context *context, const std::string &value);
+  static void Result(sqlite3_context *context,
+                     const std::chrono::year_month_day &value);
+  static void Result(sqlite3_context *context, USDA::FoodDataType value);
+
+  template <typename T>
+  static void Result(sqlite3_context *context, const std::optional<T> &value) {
+    if (value) {
+      Result(context, *value);
+    } else {
+      sqlite3_result_null(context);
+    }
+  }
+
+  /** SQL type declared for a column of type T */
+  template <typename T> static const char *SqlType() {
+    if constexpr (std::is_same_v<T, int>) {
+      return "INTEGER";
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return "REAL";
+    } else {
+      return "TEXT";
+    }
+  }
+
+private:
+  bool order_checked = false;
+  bool ordered = false;              ///< Rows are already in fdc_id order
+  std::vector<std::uint32_t> order; ///< Row positions sorted by fdc_id
+};
+
+/**
+ * @class SchemaMemoryTable
+ * @brief MemoryTable over a vector of models, with the columns of a CSV
+ * schema (see CsvSchema).
+ *
+ * @tparam Schema Schema descriptor of the table, e.g. USDA::FoodSchema
+ */
+template <typename Schema> class SchemaMemoryTable : public MemoryTable {
+public:
+  using Model = typename Schema::Model;
+
+  explicit SchemaMemoryTable(const std::vector<Model> &rows) : rows(rows) {
+    int column = 0;
+    std::apply(
+        [&](const auto &...field) {
+          ((findFdcId(field, column++)), ...);
+        },
+        Schema::fields);
+  }
+
+  const char *Name() const override { return Schema::table; }
+
+  std::string Declaration() const override {
+    std::string sql = "CREATE TABLE x(";
+    bool first = true;
+    std::apply(
+        [&](const auto &...field) {
+          ((sql += (first ? "" : ", "), first = false, sql += field.name,
+            sql += " ",
+            sql += SqlType<ValueType<std::decay_t<decltype(field)>>>()),
+           ...);
+        },
+        Schema::fields);
+    return sql + ")";
+  }
+
+  std::size_t Size() const override { return rows.size(); }
+
+  int FdcIdColumn() const override { return fdc_id_column; }
+
+  int FdcId(std::size_t row) const override {
+    return rows[row].*fdc_id_member;
+  }
+
+  void Result(sqlite3_context *context, std::size_t row,
+              int column) const override {
+    const Model &entry = rows[row];
+    int i = 0;
+    std::apply(
+        [&](const auto &...field) {
+          ((i++ == column ? (MemoryTable::Result(context, entry.*field.member),
+                             true)
+                          : false) ||
+           ...);
+        },
+        Schema::fields);
+  }
+
+private:
+  /** Member type of a field, without std::optional */
+  template <typename Field> struct Unwrap {
+    using type = typename Field::ValueType;
+  };
+  template <typename Field>
+    requires Field::nullable
+  struct Unwrap<Field> {
+    using type = typename Field::ValueType::value_type;
+  };
+  template <typename Field> using ValueType = typename Unwrap<Field>::type;
+
+  template <typename Field> void findFdcId(const Field &field, int column) {
+    if constexpr (std::is_same_v<typename Field::ValueType, int>) {
+      if (std::strcmp(field.name, "fdc_id") == 0) {
+        fdc_id_column = column;
+        fdc_id_member = field.member;
+      }
+    }
+  }
+
+  const std::vector<Model> &rows;
+  int fdc_id_column = -1;
+  int Model::*fdc_id_member = nullptr;
+};
+
+/**
+ * @class MemoryTableModule
+ * @brief SQLite virtual table module ("usda_mem") over the extracted tables.
+ *
+ * Exposes the model vectors of the pipeline to SQL without loading them into
+ * B-trees first:
+ *
+ * @code
+ * CREATE VIRTUAL TABLE temp.v_food_nutrient USING usda_mem(food_nutrient);
+ * SELECT count(*) FROM v_food_nutrient WHERE fdc_id BETWEEN 1000 AND 2000;
+ * INSERT INTO food_nutrients (id, fdc_id, nutrient_id, amount)
+ *     SELECT id, fdc_id, nutrient_id, amount FROM v_food_nutrient;
+ * @endcode
+ *
+ * The tables are read-only and hold no copy of the rows: each column value
+ * is read from the model when SQLite asks for it, and text is handed over
+ * without copying. Equality and range constraints on fdc_id, and ORDER BY
+ * fdc_id, are answered from the rows' fdc_id order (see
+ * MemoryTable::FdcIdOrder()) instead of a full scan.
+ *
+ * The module must outlive the connections it is registered with, and the
+ * vectors must stay unchanged while they are queried.
+ */
+class MemoryTableModule {
+public:
+  /** Name the module is registered under */
+  static constexpr const char *MODULE_NAME = "usda_mem";
+
+  /**
+   * @brief Makes a vector available as usda_mem(<Schema::table>).
+   *
+   * @param rows Extracted rows of the table
+   */
+  template <typename Schema>
+  void AddTable(const std::vector<typename Schema::Model> &rows) {
+    tables.push_back(std::make_unique<SchemaMemoryTable<Schema>>(rows));
+  }
+
+  /**
+   * @brief Registers the module with a connection and creates a temporary
+   * virtual table v_<table> for every added table.
+   *
+   * The tables live in the temp schema, so registering with the connection
+   * of the output database leaves no trace in the file.
+   *
+   * @param db Connection to register with
+   * @return true on success, false otherwise
+   */
+  bool Register(sqlite3 *db);
+
+  /** Returns the added table with the given name, or nullptr */
+  MemoryTable *Find(const std::string &name) const;
+
+private:
+  std::vector<std::unique_ptr<MemoryTable>> tables;
+};
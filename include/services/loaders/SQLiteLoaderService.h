@@ -13,21 +13,55 @@
  */
 
 #include "models/usda/BrandedFood.h"
+#include "models/usda/BrandedFoodIngredient.h"
+#include "models/usda/DimensionValue.h"
 #include "models/usda/Food.h"
+#include "models/usda/FoodAttribute.h"
 #include "models/usda/FoodCategory.h"
+#include "models/usda/FoodNutrient.h"
+#include "models/usda/FoodPortion.h"
+#include "models/usda/GtinIndexEntry.h"
+#include "models/usda/Ingredient.h"
+#include "models/usda/InputFood.h"
+#include "models/usda/MeasureUnit.h"
+#include "models/usda/Nutrient.h"
+#include "models/usda/NutrientCategoryStat.h"
+#include "models/usda/SurveyFnddsFood.h"
+#include "services/loaders/BatchInserter.h"
+#include "services/loaders/MemoryTableModule.h"
 #include "sqlite/sqlite3.h"
+#include <cstddef>
+#include <chrono>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 class SQLiteLoaderService {
 public:
+  /** Storage format of date columns */
+  enum class DateFormat {
+    Iso, ///< TEXT in ISO 8601 form ("2021-10-28")
+    Days ///< INTEGER day number since 1970-01-01 (std::chrono::sys_days)
+  };
+
+  /** Layout of the finished database file */
+  enum class OutputProfile {
+    Standard, ///< Built in place, published in WAL mode for API servers
+    Compact   ///< Read-optimized copy for shipping, see CompactInto()
+  };
+
   /**
    * @brief Constructs a SQLiteLoaderService with specified database path
    *
    * @param dbPath Path to the SQLite database file (will be created if doesn't
    * exist)
+   * @param dateFormat Storage format of date columns in created tables
    */
-  SQLiteLoaderService(const std::string &dbPath);
+  SQLiteLoaderService(const std::string &dbPath,
+                      DateFormat dateFormat = DateFormat::Iso);
 
   /**
    * @brief Destructor ensures database connection is properly closed
@@ -79,7 +113,341 @@ public:
    */
   bool LoadFoodCategory(const std::vector<USDA::FoodCategory> &food_categories);
 
+  /**
+   * @brief Loads the nutrient definitions into the database
+   *
+   * Units recognized by the unit normalization transform are written with
+   * their canonical symbol.
+   *
+   * @param nutrients Vector of Nutrient objects to insert into the database
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadNutrients(const std::vector<USDA::Nutrient> &nutrients);
+
+  /**
+   * @brief Loads the measure units into the database
+   *
+   * @param measure_units Vector of MeasureUnit objects to insert into the
+   * database
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadMeasureUnits(const std::vector<USDA::MeasureUnit> &measure_units);
+
+  /**
+   * @brief Loads the food nutrient amounts into the database
+   *
+   * Writes both the per-100 g amount and the materialized per-serving amount.
+   *
+   * @param food_nutrients Vector of FoodNutrient objects to insert into the
+   * database
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadFoodNutrients(const std::vector<USDA::FoodNutrient> &food_nutrients);
+
+  /**
+   * @brief Loads the food portions into the database
+   *
+   * @param food_portions Vector of FoodPortion objects to insert into the
+   * database
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadFoodPortions(const std::vector<USDA::FoodPortion> &food_portions);
+
+  /**
+   * @brief Loads the food attributes of the additional releases into the
+   * database
+   *
+   * Unlike the other Load methods an empty input is not an error: the table
+   * is emptied, since only some releases ship food attributes.
+   *
+   * @param food_attributes Vector of FoodAttribute objects to insert into the
+   * database
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadFoodAttributes(
+      const std::vector<USDA::FoodAttribute> &food_attributes);
+
+  /**
+   * @brief Loads the input foods (ingredients of Foundation and Survey foods)
+   * into the database
+   *
+   * An empty input empties the table, as with LoadFoodAttributes().
+   *
+   * @param input_foods Vector of InputFood objects to insert into the
+   * database
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadInputFoods(const std::vector<USDA::InputFood> &input_foods);
+
+  /**
+   * @brief Loads the FNDDS food codes of Survey foods into the database
+   *
+   * An empty input empties the table, as with LoadFoodAttributes().
+   *
+   * @param survey_fndds_foods Vector of SurveyFnddsFood objects to insert
+   * into the database
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadSurveyFnddsFoods(
+      const std::vector<USDA::SurveyFnddsFood> &survey_fndds_foods);
+
+  /**
+   * @brief Loads the GTIN barcode index into the database
+   *
+   * Inserts the normalized (gtin, fdc_id) pairs into the gtin_index table,
+   * which is clustered on the GTIN so a barcode lookup is a single B-tree
+   * search. An empty input empties the table, as with LoadFoodAttributes().
+   *
+   * @param gtin_index_entries Vector of GtinIndexEntry objects sorted by GTIN
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadGtinIndex(const std::vector<USDA::GtinIndexEntry> &gtin_index_entries);
+
+  /**
+   * @brief Loads the ingredient dictionary into the database
+   *
+   * An empty input empties the table, as with LoadFoodAttributes().
+   *
+   * @param ingredients Vector of Ingredient objects to insert into the
+   * database
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadIngredients(const std::vector<USDA::Ingredient> &ingredients);
+
+  /**
+   * @brief Loads the lookup table of a repeated branded_foods column
+   *
+   * branded_foods stores brand_owner, branded_food_category, data_source,
+   * market_country and serving_size_unit as keys (brand_owner_id, ...) into
+   * the tables brand_owners, branded_food_categories, data_sources,
+   * market_countries and serving_size_units.
+   *
+   * @param column Column of branded_food.csv ("brand_owner")
+   * @param values Distinct values of the column, see
+   * BrandedFoodDimensionTransformer
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadDimension(const std::string &column,
+                     const std::vector<USDA::DimensionValue> &values);
+
+  /**
+   * @brief Loads the branded food to ingredient links into the database
+   *
+   * An empty input empties the table, as with LoadFoodAttributes().
+   *
+   * @param branded_food_ingredients Vector of BrandedFoodIngredient objects to
+   * insert into the database
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadBrandedFoodIngredients(
+      const std::vector<USDA::BrandedFoodIngredient> &branded_food_ingredients);
+
+  /**
+   * @brief Loads the per-category nutrient statistics into the database
+   *
+   * An empty input empties the table, as with LoadFoodAttributes().
+   *
+   * @param nutrient_category_stats Vector of NutrientCategoryStat objects
+   * sorted by category type, category and nutrient
+   * @return true if loading succeeded, false if errors occurred
+   */
+  bool LoadNutrientCategoryStats(
+      const std::vector<USDA::NutrientCategoryStat> &nutrient_category_stats);
+
+  /**
+   * @brief Leaves a table out of the database
+   *
+   * The table is not created, and dropped by Initialize() if it exists.
+   * Excluding branded_foods also excludes its lookup tables (see
+   * LoadDimension()). Must be called before Initialize().
+   *
+   * @param table Name of the database table ("food_portions")
+   */
+  void ExcludeTable(const std::string &table);
+
+  /**
+   * @brief Leaves columns out of a table's schema and inserts
+   *
+   * The columns are dropped when the table is created. Load methods keep
+   * binding every column; values of excluded columns are skipped. A
+   * repeated branded_foods column ("brand_owner") excludes its key column
+   * and lookup table. Must be called before Initialize().
+   *
+   * @param table Name of the database table ("food_nutrients")
+   * @param columns Names of the excluded columns
+   */
+  void ExcludeColumns(const std::string &table,
+                      const std::unordered_set<std::string> &columns);
+
+  /**
+   * @brief Makes the following Load calls resumable
+   *
+   * Each table's load progress (rows committed so far) is recorded in the
+   * etl_checkpoints table, in the same transaction as the rows themselves,
+   * together with the input fingerprint. A later load with the same
+   * fingerprint and row count resumes after the last committed row, and
+   * skips tables that were completed. Any other load clears the table and
+   * starts over.
+   *
+   * @param fingerprint Identifies the inputs and settings the rows were
+   *                    produced from; loads are not checkpointed while empty
+   */
+  void EnableCheckpoints(const std::string &fingerprint);
+
+  /**
+   * @brief Selects the layout of the finished database
+   *
+   * The compact profile extends the secondary indexes with the columns read
+   * by the common lookups (see BuildIndexes()), and the finished build is
+   * copied with CompactInto() instead of being published in place.
+   *
+   * @param profile Output profile of the database
+   */
+  void SetOutputProfile(OutputProfile profile);
+
+  /**
+   * @brief Builds the secondary indexes after the base load, then ANALYZE
+   *
+   * createTables() only declares primary keys so that the bulk load appends
+   * to a single B-tree per table. This stage then creates the indexes on the
+   * foreign-key and lookup columns (food_nutrients.fdc_id,
+   * branded_foods.gtin_upc, ...) in one pass each, with SQLite's sorter
+   * running on helper threads (PRAGMA threads) and a page cache of
+   * INDEX_CACHE_KIB. ANALYZE then records the statistics used by the query
+   * planner.
+   *
+   * In the compact output profile the indexes also carry the columns of
+   * the common lookups: a food's nutrient amounts are read from the index
+   * alone, and foods ranked by a nutrient's amount come out in index order.
+   *
+   * Must be called after all Load methods.
+   *
+   * @return true if every index was built and analyzed, false otherwise
+   */
+  bool BuildIndexes();
+
+  /**
+   * @brief Prepares a finished build for readers
+   *
+   * Drops the load checkpoints, which only the build needs, and optionally
+   * VACUUMs the file, which rewrites it without the free pages left by
+   * recreated tables, then switches it to WAL journal mode. The mode
+   * is stored in the file, so readers of the published database neither
+   * block each other nor a later writer. Must be the only connection to the
+   * file, and should be closed before the file is published.
+   *
+   * @param vacuum Whether to VACUUM before switching to WAL
+   * @return true if the database is in WAL mode, false otherwise
+   */
+  bool Finalize(bool vacuum);
+
+  /**
+   * @brief Atomically replaces a database file with a finished build
+   *
+   * The build is renamed over the published file, so readers that open the
+   * path see either the previous database or the complete new one, and
+   * connections that are already open keep reading the previous one until
+   * they reopen. The directory is synced so the rename survives a crash.
+   *
+   * Refuses to publish while the build still has a rollback journal or WAL
+   * (it was not closed cleanly) or while the published file has a journal
+   * or a non-empty WAL, which SQLite would replay onto the new file.
+   *
+   * @param buildPath Finished build, closed and in the same directory
+   * @param dbPath Published database file
+   * @return true if the build was published, false otherwise
+   */
+  static bool Publish(const std::string &buildPath, const std::string &dbPath);
+
+  /**
+   * @brief Writes a read-optimized copy of a finished build
+   *
+   * Drops the load checkpoints, which only matter to the build, then uses
+   * VACUUM INTO to write every table and index into a fresh file with
+   * COMPACT_PAGE_SIZE pages. The copy has no free pages, each B-tree is
+   * stored in key order, and the larger pages keep the trees shallow, which
+   * makes the file small to download and quick to query from a cold cache.
+   * The copy keeps the rollback journal, so it can be opened from read-only
+   * storage.
+   *
+   * @param path File to create; an existing file is replaced
+   * @return true if the copy was written, false otherwise
+   */
+  bool CompactInto(const std::string &path);
+
+  /**
+   * @brief Writes the size of every table and index as JSON
+   *
+   * Records the page size and file size, and for every table and index its
+   * pages, bytes, payload and unused bytes (from the dbstat virtual table),
+   * plus the row count of every table, so the output profiles can be
+   * compared. Sizes are left out if SQLite was built without dbstat.
+   *
+   * @param path File to write
+   * @return true if the report was written, false otherwise
+   */
+  bool WriteBuildReport(const std::string &path);
+
+  /**
+   * @brief Builds the FTS5 full-text search tables after the base load
+   *
+   * Creates external-content FTS5 tables over foods.description
+   * (foods_fts) and over the brand name and ingredients of branded_foods
+   * (branded_foods_fts). The tables index the already loaded rows instead of
+   * storing a second copy of the text, and are populated in large batches
+   * with incremental merging disabled, followed by a single optimize pass.
+   *
+   * Must be called after LoadFoods() and LoadBrandedFood().
+   *
+   * @return true if both indexes were built, false if errors occurred
+   */
+  bool BuildFullTextIndex();
+
+  /**
+   * @brief Exposes extracted tables on this connection as v_<table>
+   *
+   * Registers the usda_mem virtual table module (see MemoryTableModule) and
+   * creates its temporary tables, so SQL run on this connection can read the
+   * in-memory rows, e.g. to validate them or to INSERT ... SELECT them into
+   * the loaded tables.
+   *
+   * @param module Module holding the tables; must outlive the connection
+   * @return true if every table was created, false otherwise
+   */
+  bool RegisterMemoryTables(MemoryTableModule &module);
+
+  /**
+   * @brief Runs SQL statements and prints the rows they return
+   *
+   * Each statement's result is printed to std::cout with a header of column
+   * names, one row per line and values separated by '|'. Execution stops at
+   * the first statement that fails.
+   *
+   * @param sql One or more SQL statements
+   * @return true if every statement ran, false otherwise
+   */
+  bool RunQueries(const std::string &sql);
+
 private:
+  /** Wall-clock time each transaction should cover */
+  static constexpr double TRANSACTION_SECONDS = 1.0;
+
+  /** Size of the first transaction, before the insert rate is known */
+  static constexpr std::size_t INITIAL_TRANSACTION_ROWS = 50000;
+
+  /** Bounds of the adaptive transaction size */
+  static constexpr std::size_t MIN_TRANSACTION_ROWS = 10000;
+  static constexpr std::size_t MAX_TRANSACTION_ROWS = 1000000;
+
+  /** Page cache used while building indexes, in KiB */
+  static constexpr std::size_t INDEX_CACHE_KIB = 256 * 1024;
+
+  /** Page size of compact copies, the largest SQLite supports */
+  static constexpr int COMPACT_PAGE_SIZE = 65536;
+
+  /** Bytes needed to format a date as ISO text */
+  static constexpr std::size_t DATE_BUFFER_SIZE = 16;
+
   /**
    * @brief Creates all required tables in the database
    *
@@ -90,6 +458,30 @@ private:
    */
   bool createTables();
 
+  /**
+   * @brief CREATE TABLE statement of every loaded table, in creation order
+   *
+   * @return Pairs of table name and CREATE TABLE statement
+   */
+  std::vector<std::pair<std::string, std::string>> tableDefinitions() const;
+
+  /**
+   * @brief Creates one table and drops its excluded columns
+   *
+   * @param table Name of the table
+   * @param sql CREATE TABLE statement of the table
+   * @return true if the table was created, false otherwise
+   */
+  bool createTable(const std::string &table, const std::string &sql);
+
+  /**
+   * @brief Drops a table and creates it again, empty
+   *
+   * @param table Name of the table
+   * @return true on success, false otherwise
+   */
+  bool recreateTable(const std::string &table);
+
   /**
    * @brief Begins an SQLite transaction for batch operations
    *
@@ -114,17 +506,87 @@ private:
   void rollbackTransaction();
 
   /**
-   * @brief Prepares an SQLite statement for inserting data
+   * @brief Inserts all rows of a table with multi-row INSERT statements
    *
-   * Creates and returns a prepared statement for the given table and columns,
-   * improving performance for batch insertions.
+   * Rows are written through a BatchInserter. Transactions are committed
+   * between statements and sized from the measured insert rate, so each
+   * covers about TRANSACTION_SECONDS of work instead of a fixed row count.
+   * With checkpoints enabled, each commit also records the load progress
+   * and a resumed load starts after the last committed row.
    *
    * @param table Name of the table to insert into
-   * @param columns Vector of column names for the insert statement
-   * @return Pointer to prepared SQLite statement, nullptr if preparation failed
+   * @param columns Column names, in the order bindRow binds them
+   * @param rows Entries to insert
+   * @param label Record name used in messages ("food nutrient")
+   * @param bindRow Binds one entry: void(BatchInserter::Row &, const T &)
+   * @return true if every row was inserted, false if the load was rolled back
    */
-  sqlite3_stmt *prepareInsertStatement(const std::string &table,
-                                       const std::vector<std::string> &columns);
+  template <typename T, typename BindRow>
+  bool insertRows(const std::string &table,
+                  const std::vector<std::string> &columns,
+                  const std::vector<T> &rows, const std::string &label,
+                  BindRow bindRow);
+
+  /**
+   * @brief Looks up where a table's load should start
+   *
+   * Clears the table and resets its checkpoint unless an earlier load of the
+   * same inputs can be resumed.
+   *
+   * @param table Table about to be loaded
+   * @param totalRows Number of rows the table will hold once loaded
+   * @param resumeRow Receives the index of the first row to insert
+   * @return true on success, false if the checkpoint could not be read or
+   *         reset
+   */
+  bool startCheckpoint(const std::string &table, std::size_t totalRows,
+                       std::size_t &resumeRow);
+
+  /**
+   * @brief Forgets the load progress of a table that was dropped or created
+   *
+   * @return true on success, false otherwise
+   */
+  bool clearCheckpoint(const std::string &table);
+
+  /**
+   * @brief Records the rows committed so far inside the open transaction
+   *
+   * @return true on success or when checkpoints are disabled
+   */
+  bool saveCheckpoint(const std::string &table, std::size_t rowsCommitted);
+
+  /**
+   * @brief Populates one external-content FTS5 table from its content table
+   *
+   * @param ftsTable Name of the FTS5 table to create and populate
+   * @param contentTable Name of the table holding the indexed text
+   * @param rowidColumn INTEGER PRIMARY KEY column of the content table
+   * @param columns Text columns of the content table to index
+   * @return true if the table was built, false otherwise
+   */
+  bool buildFullTextTable(const std::string &ftsTable,
+                          const std::string &contentTable,
+                          const std::string &rowidColumn,
+                          const std::vector<std::string> &columns);
+
+  /**
+   * @brief Executes one or more SQL statements that return no rows
+   *
+   * @param sql SQL text to execute
+   * @param context Description of the operation, used in error messages
+   * @return true if execution succeeded, false otherwise
+   */
+  bool executeStatement(const std::string &sql, const std::string &context);
+
+  /**
+   * @brief Checks that a table exists and has the given columns
+   *
+   * @param table Name of the table
+   * @param columns Comma-separated column names
+   * @return true if a query over the columns compiles, false otherwise
+   */
+  bool hasColumns(const std::string &table, const std::string &columns);
 
   /**
    * @brief Checks if a table exists in the database
@@ -150,9 +612,41 @@ private:
    */
   bool finalizeStatement(sqlite3_stmt *stmt);
 
+  /**
+   * @brief Binds a date in the configured date format
+   *
+   * ISO dates are formatted into the row's scratch space and bound without
+   * copying.
+   */
+  void bindDate(BatchInserter::Row &row,
+                const std::chrono::year_month_day &date) const;
+
+  /** Binds an optional date in the configured date format, or NULL */
+  void bindDate(BatchInserter::Row &row,
+                const std::optional<std::chrono::year_month_day> &date) const;
+
+  /** SQL column type of date columns for the configured date format */
+  const char *dateColumnType() const;
+
   /** SQLite database connection handle */
   sqlite3 *db = nullptr;
 
+  /** Storage format of date columns */
+  DateFormat dateFormat;
+
+  /** Layout of the finished database */
+  OutputProfile outputProfile = OutputProfile::Standard;
+
+  /** Tables left out of the database */
+  std::unordered_set<std::string> excludedTables;
+
+  /** Columns left out of each table */
+  std::unordered_map<std::string, std::unordered_set<std::string>>
+      excludedColumns;
+
+  /** Input fingerprint stored with checkpoints; empty when disabled */
+  std::string checkpointFingerprint;
+
   /** Flag indicating if a transaction is currently active */
   bool transactionActive = false;
 };
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "models/usda/BrandedFood.h"
+#include "models/usda/DimensionValue.h"
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+/**
+ * @brief Transformer that moves the repeated text columns of branded foods
+ * into dictionaries.
+ *
+ * Columns such as brand_owner and branded_food_category hold a few thousand
+ * distinct values over millions of rows. Each distinct value is assigned an
+ * integer ID, stored on the rows (BrandedFood::brand_owner_id, ...), so the
+ * database keeps one copy of every value in a lookup table and the rows
+ * carry small integer keys. Rows are scanned in parallel; each task interns
+ * into private dictionaries, which are merged in input order so the assigned
+ * IDs are deterministic, and the rows are then rewritten to the merged IDs
+ * in parallel.
+ */
+class BrandedFoodDimensionTransformer {
+public:
+  /** Columns of branded_food.csv stored as dictionaries, in output order */
+  static constexpr const char *COLUMNS[] = {
+      "brand_owner", "branded_food_category", "data_source", "market_country",
+      "serving_size_unit"};
+
+  /** Number of dictionaries */
+  static constexpr std::size_t DIMENSION_COUNT = std::size(COLUMNS);
+
+  /** Distinct values of every column, in the order of COLUMNS */
+  using Dictionaries =
+      std::array<std::vector<USDA::DimensionValue>, DIMENSION_COUNT>;
+
+  BrandedFoodDimensionTransformer() = default;
+  ~BrandedFoodDimensionTransformer() = default;
+
+  /**
+   * @brief Builds the dictionaries and assigns the rows' dictionary IDs.
+   *
+   * Serving size units are taken as stored: the canonical symbol of a
+   * normalized unit, or the raw text of an unrecognized one. Must therefore
+   * run after UnitNormalizationTransformer.
+   *
+   * @param branded_food_entries Branded foods; their *_id fields are set
+   * @param dimension_entries Output dictionaries, replaced with one entry per
+   *                          distinct value (IDs are 1-based, in order of
+   *                          first appearance)
+   */
+  static void
+  TransformData(std::vector<USDA::BrandedFood> &branded_food_entries,
+                Dictionaries &dimension_entries);
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "models/usda/Food.h"
+#include "models/usda/FoodAttribute.h"
+#include "models/usda/FoodNutrient.h"
+#include "models/usda/FoodPortion.h"
+#include "models/usda/InputFood.h"
+#include "models/usda/SurveyFnddsFood.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Transformer that merges several FDC releases into one set of tables.
+ *
+ * Food Data Central publishes each data type (Foundation, SR Legacy, Survey
+ * (FNDDS), Branded) as its own release, and the full download repeats some
+ * of them. Every release is extracted on its own; this transformer keeps the
+ * food types each release is responsible for, resolves FDC IDs that appear
+ * in more than one release, and concatenates the per-food tables.
+ */
+class DatasetMergeTransformer {
+public:
+  DatasetMergeTransformer() = default;
+  ~DatasetMergeTransformer() = default;
+
+  /**
+   * @struct Release
+   * @brief The per-food tables extracted from one release.
+   */
+  struct Release {
+    std::string name;                          ///< Used in messages
+    std::vector<USDA::FoodDataType> data_types; ///< Food types kept
+    std::vector<USDA::Food> foods;
+    std::vector<USDA::FoodNutrient> food_nutrients;
+    std::vector<USDA::FoodPortion> food_portions;
+    std::vector<USDA::FoodAttribute> food_attributes;
+    std::vector<USDA::InputFood> input_foods;
+    std::vector<USDA::SurveyFnddsFood> survey_fndds_foods;
+  };
+
+  /**
+   * @brief Merges every release into the first one.
+   *
+   * Foods whose type is not among their release's data_types are dropped
+   * together with their rows, so a type is taken only from the release that
+   * owns it. An FDC ID left in several releases is kept from the release
+   * with the latest publication_date, and from the earliest release on a
+   * tie; the other releases drop it with its rows. The remaining rows of
+   * the later releases are then moved to the end of the first release's
+   * tables, and the later releases are left empty.
+   *
+   * @param releases Releases in order of precedence; the first is the
+   *                 primary release and receives the merged tables
+   */
+  static void TransformData(std::vector<Release> &releases);
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "models/usda/BrandedFood.h"
+#include "models/usda/Food.h"
+#include "models/usda/FoodNutrient.h"
+#include "models/usda/FoodPortion.h"
+#include <vector>
+
+/**
+ * @brief Transformer that keeps only the latest branded food per barcode.
+ *
+ * The branded dataset contains several submissions of the same product, each
+ * with its own FDC ID but sharing a GTIN/UPC. This transformer groups branded
+ * foods by normalized GTIN and keeps the most recent submission of each
+ * group, then removes the superseded FDC IDs from every related collection.
+ */
+class DuplicateGtinTransformer {
+public:
+  DuplicateGtinTransformer() = default;
+  ~DuplicateGtinTransformer() = default;
+
+  /**
+   * @brief Removes superseded branded food submissions and their related rows.
+   *
+   * Branded foods are hash-partitioned by normalized GTIN so each thread
+   * resolves its own set of barcodes without locking. Within a barcode the
+   * winner is the entry with the latest modified_date, then available_date,
+   * then the highest FDC ID. Entries without a valid GTIN are never removed.
+   * The losing FDC IDs are collected into a bitmap that is applied to all
+   * four collections.
+   *
+   * @param branded_food_entries Branded foods to deduplicate
+   * @param food_entries Food entries to filter by the removed FDC IDs
+   * @param food_nutrient_entries Food nutrient entries to filter
+   * @param food_portion_entries Food portion entries to filter
+   */
+  static void
+  TransformData(std::vector<USDA::BrandedFood> &branded_food_entries,
+                std::vector<USDA::Food> &food_entries,
+                std::vector<USDA::FoodNutrient> &food_nutrient_entries,
+                std::vector<USDA::FoodPortion> &food_portion_entries);
+};
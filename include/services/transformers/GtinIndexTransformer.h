@@ -0,0 +1,49 @@
+#pragma once
+
+#include "models/usda/BrandedFood.h"
+#include "models/usda/GtinIndexEntry.h"
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Transformer that builds a barcode lookup index from branded foods.
+ *
+ * The gtin_upc column of branded_food.csv mixes UPC-A, EAN-13 and GTIN-14
+ * codes with inconsistent zero padding. This transformer normalizes every
+ * code to a canonical GTIN-14 integer, rejects codes with an invalid GS1
+ * check digit, and produces an array of (gtin, fdc_id) pairs sorted by GTIN
+ * so that a lookup is a single binary search over contiguous memory.
+ */
+class GtinIndexTransformer {
+public:
+  GtinIndexTransformer() = default;
+  ~GtinIndexTransformer() = default;
+
+  /**
+   * @brief Normalizes a raw GTIN/UPC string to a canonical GTIN-14 integer.
+   *
+   * Spaces and dashes are ignored, leading zeros are dropped (they are implied
+   * by the fixed 14 digit width), and the GS1 mod-10 check digit is verified.
+   *
+   * @param raw The gtin_upc value as it appears in branded_food.csv
+   * @return The GTIN as an integer, or std::nullopt if the code is malformed,
+   *         shorter than 8 digits, longer than 14 digits, or fails the check
+   *         digit
+   */
+  static std::optional<std::uint64_t> NormalizeGtin(std::string_view raw);
+
+  /**
+   * @brief Builds the sorted GTIN index from the branded food entries.
+   *
+   * Entries are ordered by GTIN and then by FDC ID, so products that share a
+   * barcode are adjacent and a lower-bound search returns all of them.
+   *
+   * @param branded_food_entries Branded foods providing the gtin_upc values
+   * @param gtin_index_entries Output collection, replaced with the sorted index
+   */
+  static void
+  TransformData(const std::vector<USDA::BrandedFood> &branded_food_entries,
+                std::vector<USDA::GtinIndexEntry> &gtin_index_entries);
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "models/usda/BrandedFood.h"
+#include "models/usda/BrandedFoodIngredient.h"
+#include "models/usda/Ingredient.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Transformer that parses branded food ingredient lists into a
+ * normalized ingredient dictionary.
+ *
+ * The ingredients column of branded_food.csv is a free-text label such as
+ * "ENRICHED FLOUR (WHEAT FLOUR, NIACIN), SUGAR, SALT.". This transformer
+ * splits every label into individual ingredients, assigns each distinct
+ * ingredient an integer ID, and records which ingredients appear on which
+ * product and in what order. Labels are tokenized in parallel; each task
+ * interns into a private dictionary, and the dictionaries are merged in input
+ * order so the assigned IDs are deterministic.
+ */
+class IngredientTransformer {
+public:
+  IngredientTransformer() = default;
+  ~IngredientTransformer() = default;
+
+  /**
+   * @brief Splits an ingredient label into normalized ingredient names.
+   *
+   * Commas, semicolons, parentheses and brackets all separate ingredients,
+   * so sub-ingredient lists are flattened after their parent ingredient.
+   * Names are ASCII case-folded, whitespace is collapsed, surrounding
+   * punctuation is trimmed, and qualifiers such as "contains 2% or less of:"
+   * and a leading "and " are dropped.
+   *
+   * @param label Raw ingredient label
+   * @param ingredients Output collection; names are appended in label order
+   */
+  static void TokenizeIngredients(std::string_view label,
+                                  std::vector<std::string> &ingredients);
+
+  /**
+   * @brief Builds the ingredient dictionary and the product/ingredient links.
+   *
+   * @param branded_food_entries Branded foods providing the ingredient labels
+   * @param ingredient_entries Output dictionary, replaced with one entry per
+   *                           distinct ingredient
+   * @param branded_food_ingredient_entries Output links, replaced with one
+   *                                        entry per ingredient occurrence
+   */
+  static void TransformData(
+      const std::vector<USDA::BrandedFood> &branded_food_entries,
+      std::vector<USDA::Ingredient> &ingredient_entries,
+      std::vector<USDA::BrandedFoodIngredient> &branded_food_ingredient_entries);
+};
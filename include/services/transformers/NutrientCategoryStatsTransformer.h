@@ -0,0 +1,45 @@
+#pragma once
+
+#include "models/usda/BrandedFood.h"
+#include "models/usda/Food.h"
+#include "models/usda/FoodNutrient.h"
+#include "models/usda/NutrientCategoryStat.h"
+#include <vector>
+
+/**
+ * @brief Transformer that summarizes nutrient amounts per food category.
+ *
+ * "Compared to similar foods" needs the distribution of each nutrient within
+ * a category. This transformer computes, for every (category, nutrient)
+ * pair, the number of foods, the mean and the 10th, 50th and 90th
+ * percentile of the per-100 g amounts, once at ETL time. Categories are
+ * taken from the food_category_id of foods and the branded_food_category
+ * of branded foods.
+ */
+class NutrientCategoryStatsTransformer {
+public:
+  NutrientCategoryStatsTransformer() = default;
+  ~NutrientCategoryStatsTransformer() = default;
+
+  /**
+   * @brief Computes the nutrient statistics of every category.
+   *
+   * Categories are numbered and looked up through dense arrays indexed by
+   * FDC ID. Food nutrients are then aggregated in one parallel pass over
+   * row ranges: each thread keeps its own partial aggregates per (category,
+   * nutrient), a sum and a QuantileSketch, so no locking is needed. The
+   * partial aggregates are merged afterwards; percentiles are within the
+   * sketch's relative accuracy, means are exact.
+   *
+   * @param food_entries Foods providing food_category_id
+   * @param branded_food_entries Branded foods providing branded_food_category
+   * @param food_nutrient_entries Food nutrient amounts to summarize
+   * @param nutrient_category_stat_entries Receives one entry per (category,
+   *        nutrient) pair, sorted by category type, category and nutrient
+   */
+  static void TransformData(
+      const std::vector<USDA::Food> &food_entries,
+      const std::vector<USDA::BrandedFood> &branded_food_entries,
+      const std::vector<USDA::FoodNutrient> &food_nutrient_entries,
+      std::vector<USDA::NutrientCategoryStat> &nutrient_category_stat_entries);
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "models/usda/BrandedFood.h"
+#include "models/usda/FoodNutrient.h"
+#include <vector>
+
+/**
+ * @brief Transformer that materializes per-serving nutrient amounts.
+ *
+ * FoodData Central reports nutrient amounts per 100 g (or per 100 ml for
+ * liquids), while labels are read per serving. This transformer scales every
+ * food nutrient amount by its food's serving size so the per-serving value
+ * is computed once at ETL time instead of in every query.
+ */
+class PerServingNutrientTransformer {
+public:
+  PerServingNutrientTransformer() = default;
+  ~PerServingNutrientTransformer() = default;
+
+  /**
+   * @brief Computes FoodNutrient::amount_per_serving for all entries.
+   *
+   * Serving sizes are converted to grams or milliliters using the normalized
+   * BrandedFood::serving_unit, so UnitNormalizationTransformer must run first.
+   * The per-100 scale factors are gathered into a dense array indexed by
+   * FDC ID. Food nutrients are then processed in parallel row ranges: each
+   * block of rows is gathered into contiguous float columns where NaN marks a
+   * missing amount or serving size, multiplied in a branch-free loop the
+   * compiler vectorizes, and written back. Entries without a usable serving
+   * size (e.g., foundation foods) keep an empty amount_per_serving.
+   *
+   * @param branded_food_entries Branded foods providing the serving sizes
+   * @param food_nutrient_entries Food nutrient entries to complete
+   */
+  static void
+  TransformData(const std::vector<USDA::BrandedFood> &branded_food_entries,
+                std::vector<USDA::FoodNutrient> &food_nutrient_entries);
+};
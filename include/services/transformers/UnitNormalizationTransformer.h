@@ -0,0 +1,234 @@
+#pragma once
+
+#include "models/usda/BrandedFood.h"
+#include "models/usda/FoodPortion.h"
+#include "models/usda/MeasureUnit.h"
+#include "models/usda/Nutrient.h"
+#include "models/usda/Unit.h"
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace UnitLookup {
+
+/** One spelling of a unit as it appears in the USDA files */
+struct Alias {
+  std::string_view name; // Lowercase spelling
+  USDA::Unit unit;
+};
+
+/** Every recognized spelling; matching is ASCII case-insensitive */
+inline constexpr Alias ALIASES[] = {
+    {"g", USDA::Unit::Gram},
+    {"gm", USDA::Unit::Gram},
+    {"grm", USDA::Unit::Gram},
+    {"gram", USDA::Unit::Gram},
+    {"grams", USDA::Unit::Gram},
+    {"mg", USDA::Unit::Milligram},
+    {"milligram", USDA::Unit::Milligram},
+    {"milligrams", USDA::Unit::Milligram},
+    {"ug", USDA::Unit::Microgram},
+    {"mcg", USDA::Unit::Microgram},
+    {"\xC2\xB5g", USDA::Unit::Microgram}, // micro sign
+    {"\xCE\xBCg", USDA::Unit::Microgram}, // greek small letter mu
+    {"microgram", USDA::Unit::Microgram},
+    {"micrograms", USDA::Unit::Microgram},
+    {"kg", USDA::Unit::Kilogram},
+    {"kgm", USDA::Unit::Kilogram},
+    {"kilogram", USDA::Unit::Kilogram},
+    {"kilograms", USDA::Unit::Kilogram},
+    {"oz", USDA::Unit::Ounce},
+    {"onz", USDA::Unit::Ounce},
+    {"ounce", USDA::Unit::Ounce},
+    {"ounces", USDA::Unit::Ounce},
+    {"lb", USDA::Unit::Pound},
+    {"lbs", USDA::Unit::Pound},
+    {"lbr", USDA::Unit::Pound},
+    {"pound", USDA::Unit::Pound},
+    {"pounds", USDA::Unit::Pound},
+    {"ml", USDA::Unit::Milliliter},
+    {"mlt", USDA::Unit::Milliliter},
+    {"cc", USDA::Unit::Milliliter},
+    {"cm3", USDA::Unit::Milliliter},
+    {"cubic centimeter", USDA::Unit::Milliliter},
+    {"milliliter", USDA::Unit::Milliliter},
+    {"milliliters", USDA::Unit::Milliliter},
+    {"millilitre", USDA::Unit::Milliliter},
+    {"l", USDA::Unit::Liter},
+    {"ltr", USDA::Unit::Liter},
+    {"liter", USDA::Unit::Liter},
+    {"liters", USDA::Unit::Liter},
+    {"litre", USDA::Unit::Liter},
+    {"fl oz", USDA::Unit::FluidOunce},
+    {"floz", USDA::Unit::FluidOunce},
+    {"oza", USDA::Unit::FluidOunce},
+    {"fluid ounce", USDA::Unit::FluidOunce},
+    {"tsp", USDA::Unit::Teaspoon},
+    {"teaspoon", USDA::Unit::Teaspoon},
+    {"teaspoons", USDA::Unit::Teaspoon},
+    {"tbsp", USDA::Unit::Tablespoon},
+    {"tbs", USDA::Unit::Tablespoon},
+    {"tablespoon", USDA::Unit::Tablespoon},
+    {"tablespoons", USDA::Unit::Tablespoon},
+    {"cup", USDA::Unit::Cup},
+    {"cups", USDA::Unit::Cup},
+    {"pt", USDA::Unit::Pint},
+    {"pint", USDA::Unit::Pint},
+    {"qt", USDA::Unit::Quart},
+    {"quart", USDA::Unit::Quart},
+    {"gal", USDA::Unit::Gallon},
+    {"gallon", USDA::Unit::Gallon},
+    {"in3", USDA::Unit::CubicInch},
+    {"cubic inch", USDA::Unit::CubicInch},
+    {"kcal", USDA::Unit::Kilocalorie},
+    {"kilocalorie", USDA::Unit::Kilocalorie},
+    {"kj", USDA::Unit::Kilojoule},
+    {"kilojoule", USDA::Unit::Kilojoule},
+    {"iu", USDA::Unit::InternationalUnit},
+    {"international unit", USDA::Unit::InternationalUnit},
+    {"mg_ate", USDA::Unit::MilligramAlphaTocopherolEquivalent},
+    {"mg_gae", USDA::Unit::MilligramGallicAcidEquivalent},
+    {"umol_te", USDA::Unit::MicromoleTroloxEquivalent},
+    {"sp_gr", USDA::Unit::SpecificGravity},
+    {"ph", USDA::Unit::PH},
+};
+
+inline constexpr std::size_t ALIAS_COUNT = std::size(ALIASES);
+inline constexpr std::size_t TABLE_SIZE = 512; // Power of two
+inline constexpr std::uint8_t EMPTY_SLOT = 0xFF;
+static_assert(ALIAS_COUNT < EMPTY_SLOT, "slot indexes must fit in a byte");
+
+constexpr char FoldCase(char c) {
+  return c >= 'A' && c <= 'Z' ? static_cast<char>(c | 0x20) : c;
+}
+
+/** Seeded, case-insensitive FNV-1a */
+constexpr std::uint32_t Hash(std::string_view s, std::uint32_t seed) {
+  std::uint32_t h = 2166136261u ^ seed;
+  for (const char c : s) {
+    h ^= static_cast<std::uint8_t>(FoldCase(c));
+    h *= 16777619u;
+  }
+  return h ^ (h >> 15);
+}
+
+/** Searches for a seed under which every alias hashes to its own slot */
+constexpr std::uint32_t FindSeed() {
+  for (std::uint32_t seed = 1; seed < 100000; ++seed) {
+    bool used[TABLE_SIZE] = {};
+    bool collision = false;
+    for (const auto &alias : ALIASES) {
+      const auto slot = Hash(alias.name, seed) & (TABLE_SIZE - 1);
+      if (used[slot]) {
+        collision = true;
+        break;
+      }
+      used[slot] = true;
+    }
+    if (!collision) {
+      return seed;
+    }
+  }
+  return 0;
+}
+
+inline constexpr std::uint32_t SEED = FindSeed();
+static_assert(SEED != 0, "no perfect hash seed found for the unit aliases");
+
+/** Slot -> index into ALIASES, built at compile time */
+constexpr std::array<std::uint8_t, TABLE_SIZE> BuildSlots() {
+  std::array<std::uint8_t, TABLE_SIZE> slots{};
+  for (auto &slot : slots) {
+    slot = EMPTY_SLOT;
+  }
+  for (std::size_t i = 0; i < ALIAS_COUNT; ++i) {
+    slots[Hash(ALIASES[i].name, SEED) & (TABLE_SIZE - 1)] =
+        static_cast<std::uint8_t>(i);
+  }
+  return slots;
+}
+
+inline constexpr std::array<std::uint8_t, TABLE_SIZE> SLOTS = BuildSlots();
+
+} // namespace UnitLookup
+
+/**
+ * @brief Transformer that normalizes unit strings to the closed USDA::Unit
+ * enum and precomputes gram weights for portions.
+ *
+ * Unit strings arrive in many spellings ("g", "GRM", "grm", "MLT", "µg").
+ * They are resolved once here through a compile-time perfect-hash table, so
+ * downstream code compares one-byte enums instead of strings.
+ */
+class UnitNormalizationTransformer {
+public:
+  UnitNormalizationTransformer() = default;
+  ~UnitNormalizationTransformer() = default;
+
+  /**
+   * @brief Resolves a unit spelling to a USDA::Unit.
+   *
+   * Surrounding whitespace is ignored and ASCII letters match
+   * case-insensitively. The lookup is one hash, one table probe and one
+   * string comparison.
+   *
+   * @param name Unit as it appears in the input files
+   * @return The matching unit, or USDA::Unit::Unknown
+   */
+  static constexpr USDA::Unit ParseUnit(std::string_view name) {
+    while (!name.empty() && (name.front() == ' ' || name.front() == '\t')) {
+      name.remove_prefix(1);
+    }
+    while (!name.empty() && (name.back() == ' ' || name.back() == '\t')) {
+      name.remove_suffix(1);
+    }
+
+    const auto index =
+        UnitLookup::SLOTS[UnitLookup::Hash(name, UnitLookup::SEED) &
+                          (UnitLookup::TABLE_SIZE - 1)];
+    if (index == UnitLookup::EMPTY_SLOT) {
+      return USDA::Unit::Unknown;
+    }
+
+    const auto &alias = UnitLookup::ALIASES[index];
+    if (alias.name.size() != name.size()) {
+      return USDA::Unit::Unknown;
+    }
+    for (std::size_t i = 0; i < name.size(); ++i) {
+      if (UnitLookup::FoldCase(name[i]) != alias.name[i]) {
+        return USDA::Unit::Unknown;
+      }
+    }
+    return alias.unit;
+  }
+
+  /**
+   * @brief Normalizes the units of all unit-bearing collections.
+   *
+   * - Resolves BrandedFood::serving_size_unit into BrandedFood::serving_unit;
+   *   recognized raw strings are released since the enum replaces them
+   * - Resolves Nutrient::unit_name into Nutrient::unit
+   * - Resolves MeasureUnit::name into MeasureUnit::unit
+   * - Fills FoodPortion::gram_weight where it is missing but the portion's
+   *   measure unit is a mass unit, using a dense array indexed by
+   *   measure_unit_id
+   *
+   * @param branded_food_entries Branded foods to normalize
+   * @param nutrient_entries Nutrients to normalize
+   * @param measure_unit_entries Measure units to normalize
+   * @param food_portion_entries Food portions to complete
+   */
+  static void
+  TransformData(std::vector<USDA::BrandedFood> &branded_food_entries,
+                std::vector<USDA::Nutrient> &nutrient_entries,
+                std::vector<USDA::MeasureUnit> &measure_unit_entries,
+                std::vector<USDA::FoodPortion> &food_portion_entries);
+};
+
+static_assert(UnitNormalizationTransformer::ParseUnit("GRM") ==
+              USDA::Unit::Gram);
+static_assert(UnitNormalizationTransformer::ParseUnit(" MLT ") ==
+              USDA::Unit::Milliliter);
+static_assert(UnitNormalizationTransformer::ParseUnit("slice") ==
+              USDA::Unit::Unknown);
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "models/usda/Food.h"
+#include "models/usda/FoodAttribute.h"
 #include "models/usda/FoodNutrient.h"
 #include "models/usda/FoodPortion.h"
+#include "models/usda/InputFood.h"
+#include "models/usda/SurveyFnddsFood.h"
+#include <vector>
 
 /**
  * @brief Transformer that ensures all entries reference valid Food Data Central IDs.
@@ -18,19 +22,28 @@ public:
   ~ValidFDCIDTransformer() = default;
 
   /**
-   * @brief Filters food nutrient and portion entries to ensure valid FDC ID references.
+   * @brief Filters the per-food tables to ensure valid FDC ID references.
    *
-   * This static method removes entries from food_nutrient_entries and food_portion_entries
-   * that reference FDC IDs not present in food_entries. During extraction, certain
-   * food types (e.g., sample foods) are excluded from food_entries, but related entries
-   * might still exist in other collections. This method ensures consistency by removing
-   * those orphaned references.
+   * This static method removes entries from food_nutrient_entries,
+   * food_portion_entries and the per-food tables of the additional datasets
+   * that reference FDC IDs not present in food_entries. During extraction,
+   * certain food types (e.g., sample foods) are excluded from food_entries,
+   * and merging releases drops superseded foods, but related entries might
+   * still exist in other collections. This method ensures consistency by
+   * removing those orphaned references.
    *
    * @param food_entries The valid food entries containing the set of legitimate FDC IDs
    * @param food_nutrient_entries Collection of food nutrient entries to be filtered
    * @param food_portion_entries Collection of food portion entries to be filtered
+   * @param food_attribute_entries Collection of food attribute entries to be filtered
+   * @param input_food_entries Collection of input food entries to be filtered
+   * @param survey_fndds_food_entries Collection of survey food entries to be filtered
    */
-  static void TransformData(std::vector<USDA::Food> &food_entries,
-                     std::vector<USDA::FoodNutrient> &food_nutrient_entries,
-                     std::vector<USDA::FoodPortion> &food_portion_entries);
+  static void TransformData(
+      std::vector<USDA::Food> &food_entries,
+      std::vector<USDA::FoodNutrient> &food_nutrient_entries,
+      std::vector<USDA::FoodPortion> &food_portion_entries,
+      std::vector<USDA::FoodAttribute> &food_attribute_entries,
+      std::vector<USDA::InputFood> &input_food_entries,
+      std::vector<USDA::SurveyFnddsFood> &survey_fndds_food_entries);
 };
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <sys/uio.h>
+#include <thread>
+#include <vector>
+
+/**
+ * @class AsyncFileStreamBuf
+ * @brief Input stream buffer that keeps several large reads of a file in
+ * flight ahead of the consumer.
+ *
+ * The file is split into fixed-size blocks, and a small ring of block buffers
+ * is kept filled in file order. While the consumer (typically the CSV parser)
+ * works through one block, the following blocks are already being read, so
+ * parsing a cold file is bounded by CPU rather than by storage latency.
+ * Completed blocks are exposed to the stream directly, without copying.
+ *
+ * Two backends are available:
+ * - io_uring: all reads are queued on a per-file submission ring and reaped
+ *   by the consumer thread; no helper thread is needed
+ * - pread: a readahead thread fills the free blocks with pread(2)
+ *
+ * When io_uring is requested but the kernel, the headers or a sandbox do not
+ * allow it, the buffer falls back to pread. I/O errors end the stream;
+ * Failed() reports whether that happened.
+ */
+class AsyncFileStreamBuf : public std::streambuf {
+public:
+  /** Mechanism used to issue the reads */
+  enum class Backend { IoUring, Pread };
+
+  /**
+   * @brief Opens the file and queues the first reads.
+   *
+   * @param path File to read
+   * @param backend Preferred backend; io_uring falls back to pread
+   * @param block_size Size of each read in bytes
+   * @param depth Number of blocks kept in flight (at least 2)
+   */
+  AsyncFileStreamBuf(const std::string &path, Backend backend,
+                     std::size_t block_size = 4 * 1024 * 1024,
+                     unsigned depth = 4);
+
+  /** Cancels outstanding reads and closes the file */
+  ~AsyncFileStreamBuf() override;
+
+  AsyncFileStreamBuf(const AsyncFileStreamBuf &) = delete;
+  AsyncFileStreamBuf &operator=(const AsyncFileStreamBuf &) = delete;
+
+  /** Returns true if the file could not be opened or a read failed */
+  bool Failed() const;
+
+  /** Returns the backend actually in use after any fallback */
+  Backend ActiveBackend() const { return backend; }
+
+protected:
+  /** Releases the consumed block and exposes the next one */
+  int_type underflow() override;
+
+private:
+  /** One block buffer of the ring */
+  struct Block {
+    std::unique_ptr<char[]> data;
+    std::uint64_t offset = 0; ///< File offset of the first byte
+    std::size_t length = 0;   ///< Bytes expected in this block
+    std::size_t filled = 0;   ///< Bytes read so far
+    bool ready = false;       ///< All expected bytes have been read
+    bool pending = false;     ///< A read for this block is in flight
+    iovec vector{};           ///< io_uring read target; stable while pending
+  };
+
+  /** Assigns the next file range to a block and starts reading it */
+  void schedule(Block &block);
+
+  /** Blocks until the given block is fully read; false on error */
+  bool await(Block &block);
+
+  // io_uring backend
+  bool setupRing();
+  void teardownRing();
+  bool submitRead(std::size_t slot);
+  bool reapCompletions(bool wait);
+
+  // pread backend
+  void readahead();
+
+  std::string path;
+  Backend backend;
+  int fd = -1;
+  std::uint64_t file_size = 0;
+  std::uint64_t next_offset = 0;     ///< First byte not yet assigned to a block
+  std::uint64_t consumed_offset = 0; ///< First byte not yet exposed
+  std::size_t block_size;
+
+  std::vector<Block> blocks;
+  std::size_t current = 0;  ///< Block exposed through the get area
+  bool exposed = false;     ///< The current block is in the get area
+
+  // Written by the pread thread under `mutex`, so a waiting consumer wakes
+  // up, but read by underflow() without it, hence atomic
+  std::atomic<bool> failed = false;
+
+  // io_uring state; the rings are shared with the kernel through mmap
+  struct Ring;
+  std::unique_ptr<Ring> ring;
+
+  // pread state, guarded by `mutex`
+  std::mutex mutex;
+  std::condition_variable block_ready;
+  std::condition_variable block_free;
+  bool cancelled = false;
+  std::thread reader;
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class DecompressingStreamBuf
+ * @brief Input stream buffer that inflates a gzip file or a zip archive member
+ * on a background thread.
+ *
+ * A decompression thread reads the compressed file and inflates it into a
+ * bounded ring buffer, while the consuming thread (typically the CSV parser)
+ * drains the ring buffer through the std::streambuf interface. Inflating and
+ * parsing therefore overlap, and only the compressed bytes are read from
+ * disk.
+ *
+ * Supported inputs:
+ * - gzip files (including multi-member files), detected by the caller
+ * - members of zip archives stored uncompressed or with deflate, including
+ *   ZIP64 archives
+ *
+ * Errors on the decompression thread are reported to std::cerr and end the
+ * stream; Failed() reports whether that happened.
+ */
+class DecompressingStreamBuf : public std::streambuf {
+public:
+  /** Kind of compressed container to read */
+  enum class Format { Gzip, ZipMember };
+
+  /**
+   * @brief Starts decompressing the given input on a background thread.
+   *
+   * @param path Path of the gzip file or zip archive
+   * @param format Container format of the file at path
+   * @param member For Format::ZipMember, the member to extract; matched
+   *               against the full member path or its final path component
+   * @param ring_capacity Size of the ring buffer between the threads in bytes
+   */
+  DecompressingStreamBuf(const std::string &path, Format format,
+                         const std::string &member = "",
+                         std::size_t ring_capacity = 16 * 1024 * 1024);
+
+  /** Stops the decompression thread and waits for it to exit */
+  ~DecompressingStreamBuf() override;
+
+  DecompressingStreamBuf(const DecompressingStreamBuf &) = delete;
+  DecompressingStreamBuf &operator=(const DecompressingStreamBuf &) = delete;
+
+  /** Returns true if the decompression thread stopped because of an error */
+  bool Failed() const;
+
+protected:
+  /** Refills the get area from the ring buffer */
+  int_type underflow() override;
+
+private:
+  /** Body of the decompression thread */
+  void produce();
+
+  /** Inflates a gzip file into the ring buffer */
+  bool produceGzip();
+
+  /** Locates the member in a zip archive and inflates it into the ring */
+  bool produceZipMember();
+
+  /** Blocks until the ring has room, then appends the bytes; false if closed */
+  bool write(const char *data, std::size_t size);
+
+  /** Blocks until the ring has data, then copies up to size bytes out */
+  std::size_t read(char *data, std::size_t size);
+
+  /** Marks the end of the produced data */
+  void finish(bool failed);
+
+  std::string path;   ///< Compressed input file
+  Format format;      ///< Container format
+  std::string member; ///< Zip member to extract
+
+  // Ring buffer shared by the two threads, guarded by `mutex`
+  std::vector<char> ring;
+  std::size_t head = 0;  ///< Next byte to read
+  std::size_t count = 0; ///< Number of unread bytes
+  bool finished = false; ///< Producer has written its last byte
+  bool failed = false;   ///< Producer stopped because of an error
+  bool cancelled = false; ///< Consumer has gone away
+  mutable std::mutex mutex;
+  std::condition_variable not_empty;
+  std::condition_variable not_full;
+
+  std::vector<char> get_area; ///< Consumer-side buffer exposed to the stream
+  std::thread producer;       ///< Decompression thread
+};
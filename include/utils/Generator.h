@@ -0,0 +1,121 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+/**
+ * @class Generator
+ * @brief Lazily produced sequence of values, written as a coroutine.
+ *
+ * A minimal stand-in for C++23 std::generator: a coroutine returning
+ * Generator<T> produces values with `co_yield`, and the caller pulls them
+ * one at a time with a range-based for loop. The coroutine runs only while
+ * the caller asks for the next value, so nothing is produced ahead of time.
+ *
+ * Values are yielded by reference and stay valid until the caller advances
+ * the iterator, which lets a producer hand out one reusable object (a batch
+ * buffer, for example) instead of a new value per step. Exceptions thrown by
+ * the coroutine propagate to the caller on the next resume.
+ *
+ * @tparam T Type of the yielded values
+ */
+template <typename T> class Generator {
+public:
+  struct promise_type {
+    T *value = nullptr;
+    std::exception_ptr exception;
+
+    Generator get_return_object() {
+      return Generator(
+          std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    std::suspend_always yield_value(T &yielded) noexcept {
+      value = std::addressof(yielded);
+      return {};
+    }
+    void return_void() noexcept {}
+    void unhandled_exception() { exception = std::current_exception(); }
+
+    /** Generators only yield; awaiting inside them is not supported */
+    template <typename U> std::suspend_never await_transform(U &&) = delete;
+  };
+
+  using Handle = std::coroutine_handle<promise_type>;
+
+  /** Input iterator over the yielded values */
+  class iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    explicit iterator(Handle handle) : handle(handle) {}
+
+    T &operator*() const { return *handle.promise().value; }
+    T *operator->() const { return handle.promise().value; }
+
+    iterator &operator++() {
+      resume(handle);
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+
+    bool operator==(std::default_sentinel_t) const {
+      return !handle || handle.done();
+    }
+
+  private:
+    Handle handle = nullptr;
+  };
+
+  Generator(Generator &&other) noexcept
+      : handle(std::exchange(other.handle, nullptr)) {}
+  Generator &operator=(Generator &&other) noexcept {
+    if (this != &other) {
+      if (handle) {
+        handle.destroy();
+      }
+      handle = std::exchange(other.handle, nullptr);
+    }
+    return *this;
+  }
+  Generator(const Generator &) = delete;
+  Generator &operator=(const Generator &) = delete;
+
+  /** Destroys the coroutine, releasing everything its frame holds */
+  ~Generator() {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+
+  /** Runs the coroutine up to its first value */
+  iterator begin() {
+    if (handle) {
+      resume(handle);
+    }
+    return iterator(handle);
+  }
+
+  std::default_sentinel_t end() const { return {}; }
+
+private:
+  explicit Generator(Handle handle) : handle(handle) {}
+
+  /** Resumes the coroutine and rethrows anything it threw */
+  static void resume(Handle handle) {
+    handle.resume();
+    if (handle.promise().exception) {
+      std::rethrow_exception(std::exchange(handle.promise().exception, {}));
+    }
+  }
+
+  Handle handle = nullptr;
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+/**
+ * @file Parallel.h
+ * @brief Helpers for splitting data-parallel transform work across threads.
+ *
+ * Transformers that process millions of rows split their input into
+ * contiguous index ranges ("chunks") and run one std::async task per chunk.
+ * Each task writes only to its own chunk-local state, which the caller merges
+ * afterwards in chunk order so results stay deterministic.
+ */
+namespace Parallel {
+
+/**
+ * @brief Returns how many chunks to split a collection into.
+ *
+ * Uses one chunk per hardware thread, but never makes chunks smaller than
+ * min_chunk_size so small inputs are processed without spawning threads.
+ *
+ * @param count Number of elements to process
+ * @param min_chunk_size Smallest worthwhile number of elements per chunk
+ * @return Number of chunks, at least 1
+ */
+inline std::size_t ChunkCount(std::size_t count,
+                              std::size_t min_chunk_size = 65536) {
+  const std::size_t threads =
+      std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  const std::size_t by_size = std::max<std::size_t>(1, count / min_chunk_size);
+  return std::min(threads, by_size);
+}
+
+/**
+ * @brief Runs fn(begin, end, chunk) for each of `chunks` contiguous ranges of
+ * [0, count) concurrently and waits for all of them.
+ *
+ * Exceptions thrown by a task are rethrown to the caller.
+ *
+ * @param count Number of elements to process
+ * @param chunks Number of chunks, typically from ChunkCount()
+ * @param fn Callable invoked as fn(std::size_t begin, std::size_t end,
+ *           std::size_t chunk)
+ */
+template <typename Fn>
+void ForEachChunk(std::size_t count, std::size_t chunks, Fn &&fn) {
+  if (chunks <= 1) {
+    fn(std::size_t{0}, count, std::size_t{0});
+    return;
+  }
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(chunks);
+
+  for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+    const std::size_t begin = count * chunk / chunks;
+    const std::size_t end = count * (chunk + 1) / chunks;
+    futures.push_back(std::async(std::launch::async,
+                                 [&fn, begin, end, chunk]() {
+                                   fn(begin, end, chunk);
+                                 }));
+  }
+
+  for (auto &future : futures) {
+    future.get();
+  }
+}
+
+} // namespace Parallel
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class QuantileSketch
+ * @brief Mergeable quantile summary with a bounded relative error.
+ *
+ * Values are counted in logarithmic buckets: bucket i covers
+ * (gamma^(i-1), gamma^i] with gamma = (1 + a) / (1 - a), so every quantile
+ * is returned within a relative error a of a value of the input (the
+ * DDSketch construction). Two sketches merge by adding their bucket counts,
+ * which is what makes them suitable for thread-local partial aggregates:
+ * each thread sketches its own rows and the sketches are merged afterwards,
+ * giving the same result as one sketch over all rows.
+ *
+ * Buckets are kept sparse, sorted by index, so a group with few distinct
+ * magnitudes stays small. Zero (and values too small to bucket) are counted
+ * separately, negative values in a mirrored set of buckets.
+ */
+class QuantileSketch {
+public:
+  /** Relative accuracy of the returned quantiles */
+  static constexpr double RELATIVE_ACCURACY = 0.01;
+
+  /** Adds one value */
+  void Add(double value);
+
+  /** Adds the values counted by another sketch */
+  void Merge(const QuantileSketch &other);
+
+  /** Number of values added */
+  std::uint64_t Count() const { return count; }
+
+  /**
+   * @brief Returns the value at quantile q.
+   *
+   * @param q Quantile in [0, 1], e.g. 0.5 for the median
+   * @return Value of rank floor(q * (Count() - 1)) within the relative
+   *         accuracy, clamped to the exact minimum and maximum; 0 if empty
+   */
+  double Quantile(double q) const;
+
+private:
+  /** One logarithmic bucket */
+  struct Bucket {
+    std::int32_t index;
+    std::uint32_t count;
+  };
+
+  /** Adds count to a bucket, creating it if needed */
+  static void addToBucket(std::vector<Bucket> &buckets, std::int32_t index,
+                          std::uint32_t count);
+
+  /** Merges sorted bucket lists */
+  static void mergeBuckets(std::vector<Bucket> &into,
+                           const std::vector<Bucket> &from);
+
+  std::vector<Bucket> positive; ///< Buckets of positive values, by index
+  std::vector<Bucket> negative; ///< Buckets of -value for negative values
+  std::uint64_t zero_count = 0;
+  std::uint64_t count = 0;
+  double min = 0.0;
+  double max = 0.0;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class StructuralIndex
+ * @brief Locates the field and row separators of a CSV buffer 64 bytes at a
+ * time.
+ *
+ * Each 64-byte block is classified into bitmasks of quote, comma and newline
+ * (CR or LF) characters. A prefix XOR over the quote mask marks the bytes
+ * inside quoted fields, carried from block to block, and the commas and
+ * newlines outside them are emitted as offsets. A row parser then jumps from
+ * separator to separator instead of examining every byte.
+ *
+ * The quote mask follows RFC 4180 quoting: quotes enclose whole fields and
+ * are doubled inside them. Input that quotes differently shifts the mask, so
+ * the quote bitmap is kept for the parser to verify each field against it
+ * (see CountQuotes()). A line feed bitmap is kept as well, so the parser can
+ * count physical lines without another pass (see CountLineFeeds()).
+ *
+ * The classification kernel is chosen once at runtime from the CPU features:
+ * AVX2 or SSE2 on x86-64, a portable scalar loop elsewhere. All kernels
+ * produce identical indexes.
+ */
+class StructuralIndex {
+public:
+  /** Block classification kernel */
+  enum class Kernel {
+    Scalar, ///< One byte at a time; always available
+    Sse2,   ///< Four 16-byte compares per block
+    Avx2    ///< Two 32-byte compares per block
+  };
+
+  /** Returns the kernel used by Build() */
+  static Kernel ActiveKernel();
+
+  /**
+   * @brief Selects the kernel used by Build(), e.g. to compare kernels.
+   *
+   * @param kernel Requested kernel; one the CPU lacks is replaced by the
+   *               best supported kernel below it
+   */
+  static void SetKernel(Kernel kernel);
+
+  /** Returns a display name for a kernel ("avx2", "sse2", "scalar") */
+  static const char *KernelName(Kernel kernel);
+
+  /**
+   * @brief Indexes a buffer.
+   *
+   * @param data First byte; must not be inside a quoted field
+   * @param size Number of bytes; less than 4 GiB
+   */
+  void Build(const char *data, std::size_t size);
+
+  /** Offsets of the commas and newlines outside quoted fields, ascending */
+  const std::vector<std::uint32_t> &Separators() const { return separators; }
+
+  /** Number of separators found by the last Build() */
+  std::size_t SeparatorCount() const { return count; }
+
+  /** Returns the number of quote characters in [begin, end) */
+  std::size_t CountQuotes(std::size_t begin, std::size_t end) const;
+
+  /** Returns the number of line feeds in [begin, end), quoted or not */
+  std::size_t CountLineFeeds(std::size_t begin, std::size_t end) const;
+
+private:
+  std::vector<std::uint32_t> separators; ///< Capacity; count entries valid
+  std::size_t count = 0;
+  std::vector<std::uint64_t> quotes; ///< One bit per byte, per 64-byte block
+  std::vector<std::uint64_t> line_feeds; ///< Same layout as quotes
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class WorkerPool
+ * @brief Fixed set of threads that run submitted tasks in submission order.
+ *
+ * Unlike one std::async thread per task, the number of tasks running at
+ * once is bounded by the thread count, so many independent jobs (the tables
+ * of several releases, say) share the cores instead of oversubscribing them.
+ * Submitting the longest jobs first keeps the finishing times close
+ * together.
+ */
+class WorkerPool {
+public:
+  /**
+   * @brief Starts the worker threads.
+   *
+   * @param threads Number of threads; 0 uses one per hardware thread
+   */
+  explicit WorkerPool(std::size_t threads = 0);
+
+  /** Runs the tasks still queued, then joins the threads */
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  /** Number of worker threads */
+  std::size_t Size() const { return workers.size(); }
+
+  /**
+   * @brief Queues a task.
+   *
+   * @param fn Callable taking no arguments
+   * @return Future for the task's result; exceptions thrown by the task are
+   *         rethrown by get()
+   */
+  template <typename Fn> auto Submit(Fn fn) -> std::future<decltype(fn())> {
+    using Result = decltype(fn());
+
+    // std::function must be copyable, so the task is shared
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::move(fn));
+    std::future<Result> result = task->get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      tasks.emplace([task]() { (*task)(); });
+    }
+    available.notify_one();
+    return result;
+  }
+
+private:
+  /** Runs queued tasks until the pool is stopped and the queue is empty */
+  void work();
+
+  std::vector<std::thread> workers;
+  std::queue<std::function<void()>> tasks;
+  std::mutex mutex;
+  std::condition_variable available; ///< Signaled on new tasks and on stop
+  bool stopping = false;
+};
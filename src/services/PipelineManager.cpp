@@ -1,20 +1,191 @@
 #include "services/PipelineManager.h"
+#include "services/extractors/CsvInput.h"
+#include "services/loaders/GtinIndexFileLoaderService.h"
 #include "services/loaders/SQLiteLoaderService.h"
+#include "services/transformers/BrandedFoodDimensionTransformer.h"
+#include "services/transformers/DatasetMergeTransformer.h"
+#include "services/transformers/DuplicateGtinTransformer.h"
+#include "services/transformers/GtinIndexTransformer.h"
+#include "services/transformers/IngredientTransformer.h"
+#include "services/transformers/NutrientCategoryStatsTransformer.h"
+#include "services/transformers/PerServingNutrientTransformer.h"
+#include "services/transformers/UnitNormalizationTransformer.h"
 #include "services/transformers/ValidFDCIDTransformer.h"
+#include "utils/WorkerPool.h"
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <future>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <string_view>
+
+namespace {
+
+/** Input file keys, with the member each is read from in an fdc_archive */
+constexpr std::pair<const char *, const char *> INPUT_FILES[] = {
+    {"food_input_file", "food.csv"},
+    {"food_category_input_file", "food_category.csv"},
+    {"nutrient_input_file", "nutrient.csv"},
+    {"food_nutrient_input_file", "food_nutrient.csv"},
+    {"food_portion_input_file", "food_portion.csv"},
+    {"measure_unit_input_file", "measure_unit.csv"},
+    {"branded_food_input_file", "branded_food.csv"}};
+
+/** Additional FDC release that can be merged into the primary one */
+struct DatasetRelease {
+  const char *name;             ///< Prefix of the release's input keys
+  USDA::FoodDataType data_type; ///< Food type the release contributes
+  std::array<const char *, 5> tables; ///< CSV tables in its archive
+};
+
+/** Releases read from "<name>_archive" or "<name>_<table>_input_file" */
+constexpr DatasetRelease DATASET_RELEASES[] = {
+    {"foundation",
+     USDA::FoodDataType::Foundation,
+     {"food", "food_nutrient", "food_portion", "food_attribute",
+      "input_food"}},
+    {"sr_legacy",
+     USDA::FoodDataType::SrLegacy,
+     {"food", "food_nutrient", "food_portion"}},
+    {"survey",
+     USDA::FoodDataType::Survey,
+     {"food", "food_nutrient", "food_portion", "input_food",
+      "survey_fndds_food"}}};
+
+/** Input key of one table of an additional release */
+std::string datasetKey(const std::string &release, const char *table) {
+  return release + "_" + table + "_input_file";
+}
+
+/** Database table each CSV table is loaded into */
+constexpr std::pair<const char *, const char *> LOADED_TABLES[] = {
+    {"food", "foods"},
+    {"food_category", "food_categories"},
+    {"nutrient", "nutrients"},
+    {"food_nutrient", "food_nutrients"},
+    {"food_portion", "food_portions"},
+    {"measure_unit", "measure_units"},
+    {"branded_food", "branded_foods"},
+    {"food_attribute", "food_attributes"},
+    {"input_food", "input_foods"},
+    {"survey_fndds_food", "survey_fndds_foods"}};
+
+/**
+ * Settings that change the rows written to the database or their order;
+ * checkpoints resume by row index, and compact output sorts the rows
+ */
+constexpr const char *ROW_SETTINGS[] = {"date_format", "profile", "tables",
+                                        "exclude_columns", "output_profile"};
+
+/** 64-bit FNV-1a, continued from `hash` */
+std::uint64_t fnv1a(std::string_view text, std::uint64_t hash) {
+  for (unsigned char c : text) {
+    hash ^= c;
+    hash *= 1099511628211ull;
+  }
+  // Terminate each field so adjacent fields cannot run together
+  hash ^= 0xff;
+  hash *= 1099511628211ull;
+  return hash;
+}
+
+/** Location of an input, or an empty string if it is not configured */
+std::string locationOf(
+    const std::unordered_map<std::string, std::string> &input_map,
+    const std::string &key) {
+  auto location = input_map.find(key);
+  return location != input_map.end() ? location->second : std::string();
+}
+
+/** Orders rows by their primary key, unless they already are */
+template <typename Row, typename Key>
+void sortByPrimaryKey(std::vector<Row> &rows, Key key) {
+  auto before = [&key](const Row &a, const Row &b) { return key(a) < key(b); };
+  if (!std::is_sorted(rows.begin(), rows.end(), before)) {
+    // Stable, so rows sharing a key keep the order the load resolves them in
+    std::stable_sort(rows.begin(), rows.end(), before);
+  }
+}
+
+} // namespace
+
+PipelineManager::Dataset::Dataset(
+    const std::string &name, USDA::FoodDataType data_type,
+    const std::unordered_map<std::string, std::string> &input_map)
+    : food_extractor(locationOf(input_map, datasetKey(name, "food")),
+                     "rejects/" + name, 0),
+      food_nutrient_extractor(
+          locationOf(input_map, datasetKey(name, "food_nutrient")),
+          "rejects/" + name, 0),
+      food_portion_extractor(
+          locationOf(input_map, datasetKey(name, "food_portion")),
+          "rejects/" + name, 0),
+      food_attribute_extractor(
+          locationOf(input_map, datasetKey(name, "food_attribute")),
+          "rejects/" + name, 0),
+      input_food_extractor(
+          locationOf(input_map, datasetKey(name, "input_food")),
+          "rejects/" + name, 0),
+      survey_fndds_food_extractor(
+          locationOf(input_map, datasetKey(name, "survey_fndds_food")),
+          "rejects/" + name, 0) {
+  release.name = name;
+  release.data_types = {data_type};
+}
 
 PipelineManager::PipelineManager(
     const std::unordered_map<std::string, std::string> &input_map) try
-    : input_map(input_map),
-      branded_food_extractor_service(input_map.at("branded_food_input_file")),
-      food_category_extractor_service(input_map.at("food_category_input_file")),
-      food_extractor_service(input_map.at("food_input_file")),
-      food_nutrient_extractor_service(input_map.at("food_nutrient_input_file")),
-      food_portion_extractor_service(input_map.at("food_portion_input_file")),
-      measure_unit_extractor_service(input_map.at("measure_unit_input_file")),
-      nutrient_extractor_service(input_map.at("nutrient_input_file")) {
+    : input_map(withArchiveDefaults(input_map)),
+      food_extractor(this->input_map.at("food_input_file")),
+      food_category_extractor(this->input_map.at("food_category_input_file")),
+      nutrient_extractor(this->input_map.at("nutrient_input_file")),
+      food_nutrient_extractor(this->input_map.at("food_nutrient_input_file")),
+      food_portion_extractor(this->input_map.at("food_portion_input_file")),
+      measure_unit_extractor(this->input_map.at("measure_unit_input_file")),
+      branded_food_extractor(this->input_map.at("branded_food_input_file")) {
+  if (!Profile::FromSettings(this->input_map, profile)) {
+    std::cerr << "Unknown profile '" << this->input_map.at("profile")
+              << "', using full" << std::endl;
+  }
+  food_extractor.ApplyProfile(profile);
+  food_category_extractor.ApplyProfile(profile);
+  nutrient_extractor.ApplyProfile(profile);
+  food_nutrient_extractor.ApplyProfile(profile);
+  food_portion_extractor.ApplyProfile(profile);
+  measure_unit_extractor.ApplyProfile(profile);
+  branded_food_extractor.ApplyProfile(profile);
+
+  // A release takes part once its food table is known
+  for (const DatasetRelease &release : DATASET_RELEASES) {
+    if (!this->input_map.count(datasetKey(release.name, "food"))) {
+      continue;
+    }
+    Dataset &dataset = datasets.emplace_back(release.name, release.data_type,
+                                             this->input_map);
+    dataset.food_extractor.ApplyProfile(profile);
+    dataset.food_nutrient_extractor.ApplyProfile(profile);
+    dataset.food_portion_extractor.ApplyProfile(profile);
+    dataset.food_attribute_extractor.ApplyProfile(profile);
+    dataset.input_food_extractor.ApplyProfile(profile);
+    dataset.survey_fndds_food_extractor.ApplyProfile(profile);
+  }
+
+  auto read_backend = this->input_map.find("read_backend");
+  if (read_backend != this->input_map.end()) {
+    CsvInput::ReadBackend backend;
+    if (CsvInput::ParseReadBackend(read_backend->second, backend)) {
+      CsvInput::SetReadBackend(backend);
+    } else {
+      std::cerr << "Unknown read_backend '" << read_backend->second
+                << "', using mmap" << std::endl;
+    }
+  }
 } catch (const std::out_of_range &e) {
   std::cerr << "Missing key in input map: " << e.what() << std::endl;
   std::cerr << "Available keys: ";
@@ -25,20 +196,113 @@ PipelineManager::PipelineManager(
   throw; // Rethrow to stop execution
 }
 
+std::unordered_map<std::string, std::string>
+PipelineManager::withArchiveDefaults(
+    const std::unordered_map<std::string, std::string> &input_map) {
+  auto resolved = input_map;
+
+  // Every input not listed explicitly is read from its member of the archive
+  auto archive = input_map.find("fdc_archive");
+  if (archive != input_map.end()) {
+    for (const auto &[key, member] : INPUT_FILES) {
+      resolved.try_emplace(key, archive->second + "!" + member);
+    }
+  }
+
+  for (const DatasetRelease &release : DATASET_RELEASES) {
+    auto release_archive =
+        input_map.find(std::string(release.name) + "_archive");
+    if (release_archive == input_map.end()) {
+      continue;
+    }
+    for (const char *table : release.tables) {
+      if (table) {
+        resolved.try_emplace(datasetKey(release.name, table),
+                             release_archive->second + "!" + table + ".csv");
+      }
+    }
+  }
+
+  return resolved;
+}
+
+std::string PipelineManager::inputFingerprint() const {
+  std::uint64_t hash = 14695981039346656037ull;
+
+  // An input counts as unchanged while its location, size and modification
+  // time are; reading the contents would cost as much as the load itself
+  auto hashInput = [&hash](const std::string &location) {
+    const std::filesystem::path file = CsvInput::FilePath(location);
+
+    std::error_code error;
+    const auto size = std::filesystem::file_size(file, error);
+    const auto modified = std::filesystem::last_write_time(file, error);
+
+    hash = fnv1a(location, hash);
+    hash = fnv1a(std::to_string(error ? 0 : size), hash);
+    hash = fnv1a(std::to_string(modified.time_since_epoch().count()), hash);
+  };
+
+  for (const auto &[key, member] : INPUT_FILES) {
+    hashInput(input_map.at(key));
+  }
+
+  // Additional releases change the merged rows of every per-food table
+  for (const Dataset &dataset : datasets) {
+    for (const char *table : {"food", "food_nutrient", "food_portion",
+                              "food_attribute", "input_food",
+                              "survey_fndds_food"}) {
+      const std::string key = datasetKey(dataset.release.name, table);
+      if (input_map.count(key)) {
+        hashInput(input_map.at(key));
+      }
+    }
+  }
+
+  for (const char *setting : ROW_SETTINGS) {
+    auto value = input_map.find(setting);
+    hash = fnv1a(value != input_map.end() ? value->second : "", hash);
+  }
+
+  std::stringstream fingerprint;
+  fingerprint << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return fingerprint.str();
+}
+
 void PipelineManager::ProcessData() {
   const auto start_time = std::chrono::high_resolution_clock::now();
 
-  // Execute pipeline phases in sequence
-  ExtractData();
+  // Execute pipeline phases in sequence. The rows of an input that was not
+  // read to the end are not loaded at all, as the load checkpoints would
+  // record its partial table as done for the next run
+  const bool extracted = ExtractData();
   const auto extraction_end_time = std::chrono::high_resolution_clock::now();
 
-  TransformData();
+  if (extracted) {
+    TransformData();
+    ValidateData();
+  }
   const auto transformation_end_time =
       std::chrono::high_resolution_clock::now();
 
-  LoadData();
+  const bool loaded = extracted && LoadData();
   const auto load_end_time = std::chrono::high_resolution_clock::now();
 
+  const bool indexed = extracted && IndexData();
+  const auto index_end_time = std::chrono::high_resolution_clock::now();
+
+  // A failed build is never published; the next run resumes it
+  if (extracted && loaded && indexed) {
+    PublishData();
+  } else if (!extracted) {
+    std::cerr << "Not loading incomplete inputs; " << DATABASE_FILE
+              << " was not changed." << std::endl;
+  } else {
+    std::cerr << "Keeping " << BUILD_FILE << " unpublished; "
+              << DATABASE_FILE << " was not changed." << std::endl;
+  }
+  const auto publish_end_time = std::chrono::high_resolution_clock::now();
+
   // Calculate and report timing statistics
   const auto extraction_duration =
       std::chrono::duration_cast<std::chrono::seconds>(extraction_end_time -
@@ -57,50 +321,109 @@ void PipelineManager::ProcessData() {
   std::cout << "Data loading completed in " << load_duration.count()
             << " seconds.\n";
 
+  const auto index_duration = std::chrono::duration_cast<std::chrono::seconds>(
+      index_end_time - load_end_time);
+  std::cout << "Index build completed in " << index_duration.count()
+            << " seconds.\n";
+
+  const auto publish_duration =
+      std::chrono::duration_cast<std::chrono::seconds>(publish_end_time -
+                                                       index_end_time);
+  std::cout << "Publish completed in " << publish_duration.count()
+            << " seconds.\n";
+
   const auto total_duration = std::chrono::duration_cast<std::chrono::seconds>(
-      load_end_time - start_time);
+      publish_end_time - start_time);
   std::cout << "Total pipeline execution time: " << total_duration.count()
             << " seconds.\n";
 }
 
-void PipelineManager::ExtractData() {
-  std::cout << "Starting data extract... \n";
-
-  // Launch parsing tasks concurrently using std::async
-  // Each task runs in a separate thread for maximum parallelism
-  auto food_entries_future = std::async(std::launch::async, [&]() {
-    return food_extractor_service.GetFoodEntries();
-  });
-  auto food_category_entries_future = std::async(std::launch::async, [&]() {
-    return food_category_extractor_service.GetFoodCategoryEntries();
-  });
-  auto nutrient_entries_future = std::async(std::launch::async, [&]() {
-    return nutrient_extractor_service.GetNutrientEntries();
-  });
-  auto food_nutrient_entries_future = std::async(std::launch::async, [&]() {
-    return food_nutrient_extractor_service.GetFoodNutrientEntries();
-  });
-  auto food_portion_entries_future = std::async(std::launch::async, [&]() {
-    return food_portion_extractor_service.GetFoodPortionEntries();
-  });
-  auto measure_unit_entries_future = std::async(std::launch::async, [&]() {
-    return measure_unit_extractor_service.GetMeasureUnitEntries();
-  });
-  auto branded_food_entries_future = std::async(std::launch::async, [&]() {
-    return branded_food_extractor_service.GetBrandedFoodEntries();
-  });
-
-  // Block and wait for all tasks to finish
-  // Ordered by least memory usage to most to optimize memory consumption
-  // pattern Using std::move to transfer ownership without copying large vectors
+bool PipelineManager::ExtractData() {
+  std::cout << "Starting data extract (profile: " << profile.Name()
+            << ")... \n";
+
+  // Every table of every release becomes one task on a shared pool
+  struct ExtractTask {
+    std::size_t expected_rows;
+    std::function<bool()> run; ///< False if the input ended early
+  };
+  std::vector<ExtractTask> tasks;
+
+  // Each extractor hands its vector over by value, so the rows are moved
+  // from the extractor into their destination without ever being copied
   // (crucial for 3GB+ dataset)
-  food_category_entries = std::move(food_category_entries_future.get());
-  measure_unit_entries = std::move(measure_unit_entries_future.get());
-  nutrient_entries = std::move(nutrient_entries_future.get());
-  food_portion_entries = std::move(food_portion_entries_future.get());
-  food_entries = std::move(food_entries_future.get());
-  branded_food_entries = std::move(branded_food_entries_future.get());
-  food_nutrient_entries = std::move(food_nutrient_entries_future.get());
+  // Column profiles are kept per extractor, i.e. per worker task, and
+  // merged once every task is done
+  auto data_profile = input_map.find("data_profile");
+  const bool profiling = data_profile != input_map.end();
+  std::vector<const TableProfile *> profiles;
+
+  auto addTask = [&tasks, &profiles, profiling](auto &extractor,
+                                                auto &entries) {
+    if (extractor.Enabled()) {
+      if (profiling) {
+        extractor.EnableDataProfile();
+        profiles.push_back(extractor.DataProfile());
+      }
+      tasks.push_back({extractor.ExpectedRows(), [&extractor, &entries]() {
+                         entries = extractor.TakeEntries();
+                         return !extractor.Failed();
+                       }});
+    }
+  };
+  addTask(food_extractor, food_entries);
+  addTask(food_category_extractor, food_category_entries);
+  addTask(nutrient_extractor, nutrient_entries);
+  addTask(food_nutrient_extractor, food_nutrient_entries);
+  addTask(food_portion_extractor, food_portion_entries);
+  addTask(measure_unit_extractor, measure_unit_entries);
+  addTask(branded_food_extractor, branded_food_entries);
+
+  for (Dataset &dataset : datasets) {
+    const std::string &name = dataset.release.name;
+    auto addDatasetTask = [&](const char *table, auto &extractor,
+                              auto &entries) {
+      if (input_map.count(datasetKey(name, table))) {
+        addTask(extractor, entries);
+      }
+    };
+    DatasetMergeTransformer::Release &release = dataset.release;
+    addDatasetTask("food", dataset.food_extractor, release.foods);
+    addDatasetTask("food_nutrient", dataset.food_nutrient_extractor,
+                   release.food_nutrients);
+    addDatasetTask("food_portion", dataset.food_portion_extractor,
+                   release.food_portions);
+    addDatasetTask("food_attribute", dataset.food_attribute_extractor,
+                   release.food_attributes);
+    addDatasetTask("input_food", dataset.input_food_extractor,
+                   release.input_foods);
+    addDatasetTask("survey_fndds_food", dataset.survey_fndds_food_extractor,
+                   release.survey_fndds_foods);
+  }
+
+  // Longest tasks first, so the pool finishes with the short ones instead
+  // of waiting on one large table started last
+  std::stable_sort(tasks.begin(), tasks.end(),
+                   [](const ExtractTask &a, const ExtractTask &b) {
+                     return a.expected_rows > b.expected_rows;
+                   });
+
+  bool extracted = true;
+  {
+    WorkerPool pool;
+    std::vector<std::future<bool>> futures;
+    futures.reserve(tasks.size());
+    for (ExtractTask &task : tasks) {
+      futures.push_back(pool.Submit(std::move(task.run)));
+    }
+
+    // Block and wait for all tasks to finish
+    for (auto &future : futures) {
+      if (!future.get()) {
+        extracted = false;
+      }
+    }
+  }
 
   // Reporting
   std::cout << "Parsed " << food_entries.size() << " food entries:\n";
@@ -114,7 +437,19 @@ void PipelineManager::ExtractData() {
   std::cout << "Parsed " << measure_unit_entries.size()
             << " measure unit entries.\n";
   std::cout << "Parsed " << branded_food_entries.size()
-            << " branded food entries.\n\n";
+            << " branded food entries.\n";
+  for (const Dataset &dataset : datasets) {
+    const DatasetMergeTransformer::Release &release = dataset.release;
+    std::cout << "Parsed " << release.foods.size() << " food, "
+              << release.food_nutrients.size() << " food nutrient, "
+              << release.food_portions.size() << " food portion, "
+              << release.food_attributes.size() << " food attribute, "
+              << release.input_foods.size() << " input food and "
+              << release.survey_fndds_foods.size()
+              << " survey FNDDS food entries from the " << release.name
+              << " release.\n";
+  }
+  std::cout << "\n";
 
   // Calculate total entries and timing statistics
   auto total_entries = food_entries.size() + food_category_entries.size() +
@@ -122,44 +457,351 @@ void PipelineManager::ExtractData() {
                        food_portion_entries.size() +
                        measure_unit_entries.size() +
                        branded_food_entries.size();
+  for (const Dataset &dataset : datasets) {
+    const DatasetMergeTransformer::Release &release = dataset.release;
+    total_entries += release.foods.size() + release.food_nutrients.size() +
+                     release.food_portions.size() +
+                     release.food_attributes.size() +
+                     release.input_foods.size() +
+                     release.survey_fndds_foods.size();
+  }
 
   std::cout << "Total entries parsed: " << total_entries << "\n\n";
+
+  if (profiling) {
+    DataProfileReport report;
+    for (const TableProfile *profile : profiles) {
+      report.Add(*profile);
+    }
+    if (report.WriteJson(data_profile->second)) {
+      std::cout << "Wrote data profile to " << data_profile->second
+                << "\n\n";
+    }
+  }
+
+  return extracted;
 }
 
 void PipelineManager::TransformData() {
   // Begin data cleaning and transformation processes
 
-  // First transformation: Remove entries with invalid FDC ID references
+  // First transformation: Merge the additional datasets into the primary
+  // release. The primary release contributes the foundation and branded
+  // foods, as it always has
+  {
+    std::vector<DatasetMergeTransformer::Release> releases(1);
+    releases.reserve(datasets.size() + 1);
+    DatasetMergeTransformer::Release &primary = releases.front();
+    primary.name = "primary";
+    primary.data_types = {USDA::FoodDataType::Foundation,
+                          USDA::FoodDataType::Branded};
+    primary.foods = std::move(food_entries);
+    primary.food_nutrients = std::move(food_nutrient_entries);
+    primary.food_portions = std::move(food_portion_entries);
+    for (Dataset &dataset : datasets) {
+      releases.push_back(std::move(dataset.release));
+    }
+
+    DatasetMergeTransformer::TransformData(releases);
+
+    food_entries = std::move(primary.foods);
+    food_nutrient_entries = std::move(primary.food_nutrients);
+    food_portion_entries = std::move(primary.food_portions);
+    food_attribute_entries = std::move(primary.food_attributes);
+    input_food_entries = std::move(primary.input_foods);
+    survey_fndds_food_entries = std::move(primary.survey_fndds_foods);
+  }
+
+  // Second transformation: Remove entries with invalid FDC ID references
   // This ensures referential integrity between collections
-  ValidFDCIDTransformer::TransformData(food_entries, food_nutrient_entries,
-                                       food_portion_entries);
+  ValidFDCIDTransformer::TransformData(
+      food_entries, food_nutrient_entries, food_portion_entries,
+      food_attribute_entries, input_food_entries, survey_fndds_food_entries);
+
+  // Third transformation: Drop superseded submissions of the same product
+  DuplicateGtinTransformer::TransformData(branded_food_entries, food_entries,
+                                          food_nutrient_entries,
+                                          food_portion_entries);
+
+  // Fourth transformation: Normalize barcodes into a sorted lookup index
+  GtinIndexTransformer::TransformData(branded_food_entries,
+                                      gtin_index_entries);
+
+  // Fifth transformation: Split ingredient labels into a shared dictionary
+  if (profile.IncludesColumn("branded_food", "ingredients")) {
+    IngredientTransformer::TransformData(
+        branded_food_entries, ingredient_entries,
+        branded_food_ingredient_entries);
+  }
+
+  // Sixth transformation: Resolve unit strings to enums once for all stages
+  UnitNormalizationTransformer::TransformData(
+      branded_food_entries, nutrient_entries, measure_unit_entries,
+      food_portion_entries);
+
+  // Seventh transformation: Scale nutrient amounts to the labeled serving size
+  PerServingNutrientTransformer::TransformData(branded_food_entries,
+                                               food_nutrient_entries);
+
+  // Eighth transformation: Summarize nutrient amounts per food category
+  if (profile.IncludesTable("food_nutrient")) {
+    NutrientCategoryStatsTransformer::TransformData(
+        food_entries, branded_food_entries, food_nutrient_entries,
+        nutrient_category_stat_entries);
+  }
+
+  // Ninth transformation: Replace repeated branded food strings by keys into
+  // shared dictionaries; runs after unit normalization, whose symbols it
+  // stores
+  if (profile.IncludesTable("branded_food")) {
+    BrandedFoodDimensionTransformer::TransformData(
+        branded_food_entries, branded_food_dimension_entries);
+  }
 
   // Additional transformers would be added here in sequence
 }
 
-void PipelineManager::LoadData() {
-  SQLiteLoaderService dbLoader("usda-food-central.db");
+void PipelineManager::ValidateData() {
+  auto validation_sql = input_map.find("validation_sql");
+  if (validation_sql == input_map.end()) {
+    return;
+  }
+
+  std::ifstream file(validation_sql->second);
+  if (!file) {
+    std::cerr << "Cannot read validation_sql: " << validation_sql->second
+              << std::endl;
+    return;
+  }
+  std::stringstream sql;
+  sql << file.rdbuf();
+
+  std::cout << "Running validation queries from " << validation_sql->second
+            << "...\n";
+
+  // The virtual tables read the member vectors in place
+  MemoryTableModule module;
+  module.AddTable<USDA::FoodSchema>(food_entries);
+  module.AddTable<USDA::FoodCategorySchema>(food_category_entries);
+  module.AddTable<USDA::NutrientSchema>(nutrient_entries);
+  module.AddTable<USDA::FoodNutrientSchema>(food_nutrient_entries);
+  module.AddTable<USDA::FoodPortionSchema>(food_portion_entries);
+  module.AddTable<USDA::MeasureUnitSchema>(measure_unit_entries);
+  module.AddTable<USDA::BrandedFoodSchema>(branded_food_entries);
+  module.AddTable<USDA::FoodAttributeSchema>(food_attribute_entries);
+  module.AddTable<USDA::InputFoodSchema>(input_food_entries);
+  module.AddTable<USDA::SurveyFnddsFoodSchema>(survey_fndds_food_entries);
+
+  SQLiteLoaderService validator(":memory:");
+  if (!validator.RegisterMemoryTables(module) ||
+      !validator.RunQueries(sql.str())) {
+    std::cerr << "One or more errors occurred while running validation "
+                 "queries."
+              << std::endl;
+  }
+}
+
+bool PipelineManager::LoadData() {
+  // Dates are stored as ISO text unless day numbers are requested
+  auto date_format = SQLiteLoaderService::DateFormat::Iso;
+  auto date_format_setting = input_map.find("date_format");
+  if (date_format_setting != input_map.end() &&
+      date_format_setting->second == "days") {
+    date_format = SQLiteLoaderService::DateFormat::Days;
+  }
+
+  SQLiteLoaderService dbLoader(BUILD_FILE, date_format);
+  dbLoader.SetOutputProfile(outputProfile());
+
+  // The compact profile appends every table in primary key order, so pages
+  // are filled one after another instead of being split
+  if (outputProfile() == SQLiteLoaderService::OutputProfile::Compact) {
+    sortByPrimaryKey(food_entries, [](const auto &row) { return row.fdc_id; });
+    sortByPrimaryKey(branded_food_entries,
+                     [](const auto &row) { return row.fdc_id; });
+    sortByPrimaryKey(food_category_entries,
+                     [](const auto &row) { return row.id; });
+    sortByPrimaryKey(nutrient_entries, [](const auto &row) { return row.id; });
+    sortByPrimaryKey(measure_unit_entries,
+                     [](const auto &row) { return row.id; });
+    sortByPrimaryKey(food_portion_entries,
+                     [](const auto &row) { return row.id; });
+    sortByPrimaryKey(food_nutrient_entries,
+                     [](const auto &row) { return row.id; });
+    sortByPrimaryKey(ingredient_entries,
+                     [](const auto &row) { return row.id; });
+    sortByPrimaryKey(branded_food_ingredient_entries, [](const auto &row) {
+      return std::pair(row.fdc_id, row.position);
+    });
+    sortByPrimaryKey(gtin_index_entries, [](const auto &row) {
+      return std::pair(row.gtin, row.fdc_id);
+    });
+    sortByPrimaryKey(food_attribute_entries,
+                     [](const auto &row) { return row.id; });
+    sortByPrimaryKey(input_food_entries,
+                     [](const auto &row) { return row.id; });
+    sortByPrimaryKey(survey_fndds_food_entries,
+                     [](const auto &row) { return row.fdc_id; });
+  }
+
+  // Tables and columns left out of the profile are left out of the schema
+  for (const auto &[source, table] : LOADED_TABLES) {
+    if (!profile.IncludesTable(source)) {
+      dbLoader.ExcludeTable(table);
+    }
+  }
+  const bool load_ingredient_tables =
+      profile.IncludesColumn("branded_food", "ingredients");
+  if (!load_ingredient_tables) {
+    dbLoader.ExcludeTable("ingredients");
+    dbLoader.ExcludeTable("branded_food_ingredients");
+  }
+  const bool load_gtin_table =
+      profile.IncludesColumn("branded_food", "gtin_upc");
+  if (!load_gtin_table) {
+    dbLoader.ExcludeTable("gtin_index");
+  }
+  const bool load_stats_table = profile.IncludesTable("food_nutrient");
+  if (!load_stats_table) {
+    dbLoader.ExcludeTable("nutrient_category_stats");
+  }
+  dbLoader.ExcludeColumns("foods", food_extractor.ExcludedColumns());
+  dbLoader.ExcludeColumns("food_categories",
+                          food_category_extractor.ExcludedColumns());
+  dbLoader.ExcludeColumns("nutrients", nutrient_extractor.ExcludedColumns());
+  dbLoader.ExcludeColumns("food_nutrients",
+                          food_nutrient_extractor.ExcludedColumns());
+  dbLoader.ExcludeColumns("food_portions",
+                          food_portion_extractor.ExcludedColumns());
+  dbLoader.ExcludeColumns("measure_units",
+                          measure_unit_extractor.ExcludedColumns());
+  dbLoader.ExcludeColumns("branded_foods",
+                          branded_food_extractor.ExcludedColumns());
+  // Only the additional releases ship these tables
+  const bool load_dataset_tables = !datasets.empty();
+  if (!load_dataset_tables) {
+    dbLoader.ExcludeTable("food_attributes");
+    dbLoader.ExcludeTable("input_foods");
+    dbLoader.ExcludeTable("survey_fndds_foods");
+  } else {
+    const Dataset &dataset = datasets.front();
+    dbLoader.ExcludeColumns(
+        "food_attributes", dataset.food_attribute_extractor.ExcludedColumns());
+    dbLoader.ExcludeColumns("input_foods",
+                            dataset.input_food_extractor.ExcludedColumns());
+    dbLoader.ExcludeColumns(
+        "survey_fndds_foods",
+        dataset.survey_fndds_food_extractor.ExcludedColumns());
+  }
 
   auto initalized = dbLoader.Initialize();
 
   if (!initalized) {
     std::cerr << "Failed to initialize SQLite database." << std::endl;
-    return;
+    return false;
   }
 
+  // Resume an interrupted load of the same inputs instead of starting over
+  dbLoader.EnableCheckpoints(inputFingerprint());
+
   bool loaded = true;
 
   bool load_foods = dbLoader.LoadFoods(food_entries);
 
   food_entries.clear(); // Clear memory after loading
 
-  bool load_branded_food = dbLoader.LoadBrandedFood(branded_food_entries);
+  bool load_branded_food = !profile.IncludesTable("branded_food") ||
+                           dbLoader.LoadBrandedFood(branded_food_entries);
   branded_food_entries.clear(); // Clear memory after loading
 
-  bool load_food_category = dbLoader.LoadFoodCategory(food_category_entries);
+  bool load_dimensions = true;
+  for (std::size_t d = 0; d < BrandedFoodDimensionTransformer::DIMENSION_COUNT;
+       ++d) {
+    const char *column = BrandedFoodDimensionTransformer::COLUMNS[d];
+    if (profile.IncludesColumn("branded_food", column) &&
+        !dbLoader.LoadDimension(column, branded_food_dimension_entries[d])) {
+      load_dimensions = false;
+    }
+    branded_food_dimension_entries[d].clear(); // Clear memory after loading
+  }
+
+  bool load_ingredients =
+      !load_ingredient_tables || dbLoader.LoadIngredients(ingredient_entries);
+  ingredient_entries.clear(); // Clear memory after loading
+
+  bool load_branded_food_ingredients =
+      !load_ingredient_tables ||
+      dbLoader.LoadBrandedFoodIngredients(branded_food_ingredient_entries);
+  branded_food_ingredient_entries.clear(); // Clear memory after loading
+
+  bool load_food_category = !profile.IncludesTable("food_category") ||
+                            dbLoader.LoadFoodCategory(food_category_entries);
   food_category_entries.clear(); // Clear memory after loading
 
-  if (!load_foods || !load_branded_food) {
+  bool load_nutrients = !profile.IncludesTable("nutrient") ||
+                        dbLoader.LoadNutrients(nutrient_entries);
+  nutrient_entries.clear(); // Clear memory after loading
+
+  bool load_measure_units = !profile.IncludesTable("measure_unit") ||
+                            dbLoader.LoadMeasureUnits(measure_unit_entries);
+  measure_unit_entries.clear(); // Clear memory after loading
+
+  bool load_food_portions = !profile.IncludesTable("food_portion") ||
+                            dbLoader.LoadFoodPortions(food_portion_entries);
+  food_portion_entries.clear(); // Clear memory after loading
+
+  bool load_food_nutrients =
+      !profile.IncludesTable("food_nutrient") ||
+      dbLoader.LoadFoodNutrients(food_nutrient_entries);
+  food_nutrient_entries.clear(); // Clear memory after loading
+
+  bool load_nutrient_category_stats =
+      !load_stats_table ||
+      dbLoader.LoadNutrientCategoryStats(nutrient_category_stat_entries);
+  nutrient_category_stat_entries.clear(); // Clear memory after loading
+
+  bool load_food_attributes =
+      !load_dataset_tables || !profile.IncludesTable("food_attribute") ||
+      dbLoader.LoadFoodAttributes(food_attribute_entries);
+  food_attribute_entries.clear(); // Clear memory after loading
+
+  bool load_input_foods = !load_dataset_tables ||
+                          !profile.IncludesTable("input_food") ||
+                          dbLoader.LoadInputFoods(input_food_entries);
+  input_food_entries.clear(); // Clear memory after loading
+
+  bool load_survey_fndds_foods =
+      !load_dataset_tables || !profile.IncludesTable("survey_fndds_food") ||
+      dbLoader.LoadSurveyFnddsFoods(survey_fndds_food_entries);
+  survey_fndds_food_entries.clear(); // Clear memory after loading
+
+  // Optional full-text search stage, built over the rows loaded above
+  bool build_full_text_index = true;
+  auto full_text_search = input_map.find("full_text_search");
+  if (full_text_search != input_map.end() &&
+      full_text_search->second == "true") {
+    std::cout << "Building full-text search index..." << std::endl;
+    build_full_text_index = dbLoader.BuildFullTextIndex();
+  }
+
+  bool load_gtin_index = true;
+  bool write_gtin_index_file = true;
+  if (load_gtin_table) {
+    load_gtin_index = dbLoader.LoadGtinIndex(gtin_index_entries);
+
+    // Also export the index as a standalone file that API servers can mmap
+    GtinIndexFileLoaderService gtinIndexFile("usda-gtin-index.bin");
+    write_gtin_index_file = gtinIndexFile.LoadGtinIndex(gtin_index_entries);
+  }
+  gtin_index_entries.clear(); // Clear memory after loading
+
+  if (!load_foods || !load_branded_food || !load_dimensions ||
+      !load_food_category || !load_nutrients || !load_measure_units ||
+      !load_food_portions || !load_food_nutrients ||
+      !load_nutrient_category_stats ||
+      !load_food_attributes || !load_input_foods || !load_survey_fndds_foods ||
+      !load_ingredients || !load_branded_food_ingredients ||
+      !build_full_text_index || !load_gtin_index || !write_gtin_index_file) {
     loaded = false;
   }
 
@@ -170,4 +812,72 @@ void PipelineManager::LoadData() {
   } else {
     std::cout << "Data loaded successfully." << std::endl;
   }
+  return loaded;
+}
+
+bool PipelineManager::IndexData() {
+  std::cout << "\nBuilding secondary indexes..." << std::endl;
+
+  SQLiteLoaderService dbLoader(BUILD_FILE);
+  dbLoader.SetOutputProfile(outputProfile());
+
+  if (!dbLoader.BuildIndexes()) {
+    std::cerr << "One or more errors occurred while building indexes."
+              << std::endl;
+    return false;
+  }
+  std::cout << "Indexes built successfully." << std::endl;
+  return true;
+}
+
+void PipelineManager::PublishData() {
+  std::cout << "\nPublishing " << DATABASE_FILE << "..." << std::endl;
+
+  auto vacuum = input_map.find("vacuum");
+  const bool vacuum_database =
+      vacuum != input_map.end() && vacuum->second == "true";
+  const bool compact =
+      outputProfile() == SQLiteLoaderService::OutputProfile::Compact;
+
+  // The build must be closed before it is renamed; a compact copy is
+  // already defragmented, so it is never vacuumed again
+  {
+    SQLiteLoaderService dbLoader(BUILD_FILE);
+    const bool finalized = compact ? dbLoader.CompactInto(COMPACT_FILE)
+                                   : dbLoader.Finalize(vacuum_database);
+    if (!finalized) {
+      std::cerr << "Failed to finalize " << BUILD_FILE << "." << std::endl;
+      return;
+    }
+  }
+
+  if (!SQLiteLoaderService::Publish(compact ? COMPACT_FILE : BUILD_FILE,
+                                    DATABASE_FILE)) {
+    std::cerr << "Failed to publish " << DATABASE_FILE << "." << std::endl;
+    return;
+  }
+  if (compact) {
+    std::error_code error;
+    std::filesystem::remove(BUILD_FILE, error);
+  }
+  std::cout << "Published " << DATABASE_FILE << " successfully." << std::endl;
+
+  auto build_report = input_map.find("build_report");
+  if (build_report != input_map.end()) {
+    SQLiteLoaderService report(DATABASE_FILE);
+    report.SetOutputProfile(outputProfile());
+    if (report.WriteBuildReport(build_report->second)) {
+      std::cout << "Wrote build report to " << build_report->second
+                << std::endl;
+    }
+  }
+}
+
+SQLiteLoaderService::OutputProfile PipelineManager::outputProfile() const {
+  auto output_profile = input_map.find("output_profile");
+  if (output_profile != input_map.end() &&
+      output_profile->second == "compact") {
+    return SQLiteLoaderService::OutputProfile::Compact;
+  }
+  return SQLiteLoaderService::OutputProfile::Standard;
 }
@@ -0,0 +1,98 @@
+#include "services/Profile.h"
+#include <iostream>
+#include <string_view>
+
+namespace {
+
+/** Splits a comma-separated list, trimming spaces around the entries */
+template <typename Fn> void forEachListEntry(std::string_view list, Fn &&fn) {
+  while (!list.empty()) {
+    const auto comma = list.find(',');
+    std::string_view entry = list.substr(0, comma);
+    list = comma == std::string_view::npos ? std::string_view()
+                                           : list.substr(comma + 1);
+
+    const auto first = entry.find_first_not_of(' ');
+    if (first == std::string_view::npos) {
+      continue;
+    }
+    entry = entry.substr(first, entry.find_last_not_of(' ') - first + 1);
+    fn(std::string(entry));
+  }
+}
+
+} // namespace
+
+bool Profile::FromSettings(
+    const std::unordered_map<std::string, std::string> &settings,
+    Profile &profile) {
+  profile = Profile();
+  bool known = true;
+
+  auto name = settings.find("profile");
+  if (name != settings.end() && name->second == "nutrition-core") {
+    profile.name = name->second;
+    profile.tables = {"food", "food_category", "nutrient", "food_nutrient",
+                      "branded_food"};
+    profile.excluded_columns["food_nutrient"] = {
+        "derivation_id", "min", "max", "median", "loq", "footnote"};
+    profile.excluded_columns["branded_food"] = {"subbrand_name",
+                                                "ingredients",
+                                                "not_a_significant_source_of",
+                                                "data_source",
+                                                "package_weight",
+                                                "discontinued_date",
+                                                "market_country",
+                                                "preparation_state_code",
+                                                "trade_channel",
+                                                "short_description",
+                                                "material_code"};
+  } else if (name != settings.end() && name->second != "full") {
+    known = false;
+  }
+
+  auto tables = settings.find("tables");
+  if (tables != settings.end()) {
+    profile.tables.clear();
+    forEachListEntry(tables->second, [&](std::string table) {
+      profile.tables.insert(std::move(table));
+    });
+  }
+
+  auto columns = settings.find("exclude_columns");
+  if (columns != settings.end()) {
+    forEachListEntry(columns->second, [&](const std::string &entry) {
+      const auto dot = entry.find('.');
+      if (dot == std::string::npos) {
+        std::cerr << "Ignoring exclude_columns entry '" << entry
+                  << "': expected table.column" << std::endl;
+        return;
+      }
+      profile.excluded_columns[entry.substr(0, dot)].insert(
+          entry.substr(dot + 1));
+    });
+  }
+
+  // Every other table references foods, so they are always loaded
+  if (!profile.tables.empty()) {
+    profile.tables.insert("food");
+  }
+
+  return known;
+}
+
+bool Profile::IncludesTable(const std::string &table) const {
+  return tables.empty() || tables.count(table) > 0;
+}
+
+bool Profile::IncludesColumn(const std::string &table,
+                             const std::string &column) const {
+  return IncludesTable(table) && ExcludedColumns(table).count(column) == 0;
+}
+
+const std::unordered_set<std::string> &
+Profile::ExcludedColumns(const std::string &table) const {
+  static const std::unordered_set<std::string> none;
+  auto columns = excluded_columns.find(table);
+  return columns != excluded_columns.end() ? columns->second : none;
+}
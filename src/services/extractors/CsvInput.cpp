@@ -0,0 +1,76 @@
+#include "services/extractors/CsvInput.h"
+#include <atomic>
+
+namespace {
+
+std::atomic<CsvInput::ReadBackend> read_backend = CsvInput::ReadBackend::Mmap;
+
+bool endsWith(const std::string &s, const std::string &suffix) {
+  return s.size() >= suffix.size() &&
+         s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // namespace
+
+void CsvInput::SetReadBackend(ReadBackend backend) { read_backend = backend; }
+
+bool CsvInput::ParseReadBackend(const std::string &name,
+                                ReadBackend &backend) {
+  if (name == "mmap") {
+    backend = ReadBackend::Mmap;
+  } else if (name == "io_uring") {
+    backend = ReadBackend::IoUring;
+  } else if (name == "pread") {
+    backend = ReadBackend::Pread;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+std::string CsvInput::FilePath(const std::string &input_file) {
+  const auto separator = input_file.find(".zip!");
+  if (separator != std::string::npos) {
+    return input_file.substr(0, separator + 4);
+  }
+  return input_file;
+}
+
+CsvInput::CsvInput(const std::string &input_file) {
+  const auto separator = input_file.find(".zip!");
+  const ReadBackend backend = read_backend;
+  std::unique_ptr<std::streambuf> stream_buffer;
+
+  if (separator != std::string::npos) {
+    const std::string archive = input_file.substr(0, separator + 4);
+    const std::string member = input_file.substr(separator + 5);
+    auto buffer = std::make_unique<DecompressingStreamBuf>(
+        archive, DecompressingStreamBuf::Format::ZipMember, member);
+    decompressing_buffer = buffer.get();
+    stream_buffer = std::move(buffer);
+  } else if (endsWith(input_file, ".gz")) {
+    auto buffer = std::make_unique<DecompressingStreamBuf>(
+        input_file, DecompressingStreamBuf::Format::Gzip);
+    decompressing_buffer = buffer.get();
+    stream_buffer = std::move(buffer);
+  } else if (backend != ReadBackend::Mmap) {
+    auto buffer = std::make_unique<AsyncFileStreamBuf>(
+        input_file, backend == ReadBackend::IoUring
+                        ? AsyncFileStreamBuf::Backend::IoUring
+                        : AsyncFileStreamBuf::Backend::Pread);
+    file_buffer = buffer.get();
+    stream_buffer = std::move(buffer);
+  }
+
+  if (stream_buffer) {
+    reader = std::make_unique<CsvReader>(std::move(stream_buffer));
+  } else {
+    reader = std::make_unique<CsvReader>(input_file);
+  }
+}
+
+bool CsvInput::Failed() const {
+  return reader->Failed() ||
+         (decompressing_buffer && decompressing_buffer->Failed()) ||
+         (file_buffer && file_buffer->Failed());
+}
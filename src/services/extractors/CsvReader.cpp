@@ -0,0 +1,359 @@
+#include "services/extractors/CsvReader.h"
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+inline bool isNewline(char c) { return c == '\n' || c == '\r'; }
+
+/** Returns true if every quote in the text is part of a doubled pair */
+bool quotesArePaired(std::string_view text) {
+  for (auto quote = text.find('"'); quote != std::string_view::npos;
+       quote = text.find('"', quote + 2)) {
+    if (quote + 1 == text.size() || text[quote + 1] != '"') {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+CsvReader::CsvReader(const std::string &path) {
+  fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  struct stat info {};
+  if (fd < 0 || ::fstat(fd, &info) != 0) {
+    failed = true;
+    return;
+  }
+  file_size = static_cast<std::uint64_t>(info.st_size);
+  readHeader();
+}
+
+CsvReader::CsvReader(std::unique_ptr<std::streambuf> source)
+    : source(std::move(source)) {
+  readHeader();
+}
+
+CsvReader::~CsvReader() {
+  if (mapping) {
+    ::munmap(mapping, mapping_size);
+  }
+  if (fd >= 0) {
+    ::close(fd);
+  }
+}
+
+void CsvReader::readHeader() {
+  CsvRow header;
+  if (!ReadRow(header)) {
+    return;
+  }
+  column_names.reserve(header.size());
+  for (std::size_t column = 0; column < header.size(); ++column) {
+    column_names.emplace_back(header[column]);
+  }
+}
+
+bool CsvReader::ReadRow(CsvRow &row) {
+  for (;;) {
+    skipNewlines();
+    if (pos == size) {
+      if (at_end || failed || !refill()) {
+        return false;
+      }
+      continue;
+    }
+
+    // A row that is cut short is read again from the same start
+    const std::size_t start = pos;
+    const RowStatus status = indexed ? indexedRow(row) : scannedRow(row);
+    switch (status) {
+    case RowStatus::Complete:
+      // Quoted fields may contain line breaks of their own; the index
+      // counts them even after the row parser gave up on it
+      row_line = line;
+      line += index.CountLineFeeds(start, pos);
+      unescapeFields(row);
+      return true;
+    case RowStatus::None:
+      return false;
+    case RowStatus::Irregular:
+      // The index is unreliable from this row on; parse the rest of the
+      // window byte by byte
+      indexed = false;
+      break;
+    case RowStatus::Incomplete:
+      if (at_end) {
+        // The last row has no line break; let the parser finish it
+        indexed = false;
+      } else if (!refill()) {
+        return false;
+      }
+      break;
+    }
+  }
+}
+
+void CsvReader::skipNewlines() {
+  // Every newline outside quotes is an indexed separator, so the cursor
+  // advances in step
+  while (pos < size && isNewline(data[pos])) {
+    line += data[pos] == '\n' ? 1 : 0;
+    ++pos;
+    cursor += indexed ? 1 : 0;
+  }
+}
+
+bool CsvReader::refill() {
+  const bool first = !started;
+  started = true;
+  if (pos == 0 && size > 0) {
+    // Not even one row fits; read a larger window
+    window_bytes *= 2;
+  }
+
+  if (source) {
+    // The unread rest of the window moves to the front of the buffer
+    const std::size_t from = data ? data - buffer.data() + pos : 0;
+    const std::size_t kept = size - pos;
+    buffer.resize(std::max(buffer.size(), window_bytes));
+    std::copy(buffer.begin() + from, buffer.begin() + from + kept,
+              buffer.begin());
+    const std::size_t wanted = buffer.size() - kept;
+    const auto read = static_cast<std::size_t>(source->sgetn(
+        buffer.data() + kept, static_cast<std::streamsize>(wanted)));
+    at_end = read < wanted;
+    data = buffer.data();
+    size = kept + read;
+  } else {
+    const std::uint64_t offset = file_offset + pos;
+    const auto length = static_cast<std::size_t>(
+        std::min<std::uint64_t>(window_bytes, file_size - offset));
+    if (!mapWindow(offset, length)) {
+      failed = true;
+      data = nullptr;
+      size = pos = 0;
+      return false;
+    }
+    at_end = offset + length == file_size;
+  }
+
+  pos = 0;
+  cursor = 0;
+
+  // A byte order mark can only precede the header
+  if (first && size >= 3 &&
+      data[0] == '\xEF' && data[1] == '\xBB' && data[2] == '\xBF') {
+    pos = 3;
+  }
+
+  index.Build(data + pos, size - pos);
+  if (pos > 0) {
+    // Offsets are relative to the indexed range; shift them to the window
+    data += pos;
+    size -= pos;
+    file_offset += pos;
+    pos = 0;
+  }
+  indexed = true;
+  return size > 0;
+}
+
+bool CsvReader::mapWindow(std::uint64_t offset, std::size_t length) {
+  if (mapping) {
+    ::munmap(mapping, mapping_size);
+    mapping = nullptr;
+  }
+  file_offset = offset;
+  data = nullptr;
+  size = 0;
+  if (length == 0) {
+    return true;
+  }
+
+  static const auto page = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+  const std::uint64_t aligned = offset - offset % page;
+  mapping_size = length + static_cast<std::size_t>(offset - aligned);
+  void *mapped = ::mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd,
+                        static_cast<off_t>(aligned));
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+  ::madvise(mapped, mapping_size, MADV_SEQUENTIAL | MADV_WILLNEED);
+
+  mapping = mapped;
+  data = static_cast<const char *>(mapped) + (offset - aligned);
+  size = length;
+  return true;
+}
+
+CsvReader::RowStatus CsvReader::indexedRow(CsvRow &row) {
+  row.fields.clear();
+  row.doubled_quotes.clear();
+
+  const std::vector<std::uint32_t> &separators = index.Separators();
+  const std::size_t count = index.SeparatorCount();
+  std::size_t begin = pos;
+
+  for (std::size_t next = cursor; next < count; ++next) {
+    const std::size_t end = separators[next];
+    if (!addIndexedField(row, begin, end)) {
+      return RowStatus::Irregular;
+    }
+    if (isNewline(data[end])) {
+      cursor = next + 1;
+      pos = end + 1;
+      return RowStatus::Complete;
+    }
+    begin = end + 1;
+  }
+  return RowStatus::Incomplete;
+}
+
+bool CsvReader::addIndexedField(CsvRow &row, std::size_t begin,
+                                std::size_t end) {
+  const std::size_t quotes = index.CountQuotes(begin, end);
+  if (quotes == 0) {
+    row.fields.emplace_back(data + begin, end - begin);
+    return true;
+  }
+
+  // A quoted field: quotes at both ends and doubled pairs in between
+  if (quotes % 2 != 0 || end - begin < 2 || data[begin] != '"' ||
+      data[end - 1] != '"') {
+    return false;
+  }
+  const std::string_view text(data + begin + 1, end - begin - 2);
+  if (quotes > 2) {
+    if (!quotesArePaired(text)) {
+      return false;
+    }
+    row.doubled_quotes.push_back(row.fields.size());
+  }
+  row.fields.push_back(text);
+  return true;
+}
+
+CsvReader::RowStatus CsvReader::scannedRow(CsvRow &row) {
+  row.fields.clear();
+  row.doubled_quotes.clear();
+
+  std::size_t start = pos;  // First byte of the field's text
+  std::size_t length = 0;   // Bytes of text so far
+  bool quoted = false;      // Inside a quoted field
+  bool doubled = false;     // The field contains doubled quotes
+
+  auto pushField = [&] {
+    if (doubled) {
+      row.doubled_quotes.push_back(row.fields.size());
+    }
+    row.fields.emplace_back(data + start, length);
+    length = 0;
+    doubled = false;
+  };
+
+  std::size_t i = pos;
+  while (i < size) {
+    const char c = data[i];
+    if (quoted) {
+      if (c == '"') {
+        if (i + 1 == size) {
+          if (!at_end) {
+            return RowStatus::Incomplete;
+          }
+          quoted = false;
+          ++i;
+          continue;
+        }
+        const char next = data[i + 1];
+        if (next == ',' || isNewline(next)) {
+          quoted = false;
+          ++i;
+          continue;
+        }
+        if (next == '"') {
+          doubled = true;
+          length += 2;
+          i += 2;
+          continue;
+        }
+        // A lone quote inside a quoted field is kept as text
+      }
+      ++length;
+      ++i;
+      continue;
+    }
+
+    switch (c) {
+    case ',':
+      pushField();
+      start = ++i;
+      break;
+    case '\n':
+    case '\r':
+      pushField();
+      pos = i + 1;
+      return RowStatus::Complete;
+    case '"':
+      if (length == 0) {
+        quoted = true;
+        start = ++i;
+        break;
+      }
+      [[fallthrough]];
+    default:
+      ++length;
+      ++i;
+      break;
+    }
+  }
+
+  if (!at_end) {
+    return RowStatus::Incomplete;
+  }
+
+  // End of input without a line break: a trailing empty field counts only
+  // after a comma or a closing quote
+  const char last = data[size - 1];
+  if (length > 0 || last == ',' || last == '"') {
+    pushField();
+  }
+  pos = size;
+  return row.fields.empty() ? RowStatus::None : RowStatus::Complete;
+}
+
+void CsvReader::unescapeFields(CsvRow &row) {
+  if (row.doubled_quotes.empty()) {
+    return;
+  }
+
+  // Reserve everything up front so that earlier views stay valid
+  std::size_t total = 0;
+  for (std::size_t field : row.doubled_quotes) {
+    total += row.fields[field].size();
+  }
+  row.unescaped.clear();
+  row.unescaped.reserve(total);
+
+  for (std::size_t field : row.doubled_quotes) {
+    const std::string_view text = row.fields[field];
+    const std::size_t begin = row.unescaped.size();
+    bool previous_quote = false;
+    for (char c : text) {
+      if (c == '"') {
+        if (previous_quote) {
+          previous_quote = false;
+          continue;
+        }
+        previous_quote = true;
+      }
+      row.unescaped.push_back(c);
+    }
+    row.fields[field] = std::string_view(row.unescaped.data() + begin,
+                                         row.unescaped.size() - begin);
+  }
+}
@@ -0,0 +1,442 @@
+#include "services/extractors/DataProfile.h"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+
+namespace {
+
+/** Initial size of a column's tracked value table, a power of two */
+constexpr std::size_t INITIAL_SLOTS = 64;
+
+constexpr const char *LENGTH_LABELS[ColumnProfile::LENGTH_BUCKETS] = {
+    "0", "1", "2-3", "4-7", "8-15", "16-31", "32-63", "64-127", "128-255",
+    "256+"};
+
+/** Spreads the bits of a value over all 64 bits (splitmix64) */
+inline std::uint64_t mix(std::uint64_t hash) {
+  hash ^= hash >> 30;
+  hash *= 0xbf58476d1ce4e5b9ull;
+  hash ^= hash >> 27;
+  hash *= 0x94d049bb133111ebull;
+  hash ^= hash >> 31;
+  return hash;
+}
+
+/**
+ * Hashes a value's text. Most CSV values are at most 16 bytes; those are
+ * read with two overlapping loads that cover every byte, so hashing costs
+ * two mixing rounds instead of a byte loop.
+ */
+inline std::uint64_t hashText(std::string_view text) {
+  const char *data = text.data();
+  const std::size_t size = text.size();
+  std::uint64_t first = 0;
+  std::uint64_t last = 0;
+
+  if (size > 16) {
+    return mix(std::hash<std::string_view>{}(text));
+  } else if (size >= 8) {
+    std::memcpy(&first, data, 8);
+    std::memcpy(&last, data + size - 8, 8);
+  } else if (size >= 4) {
+    std::uint32_t low;
+    std::uint32_t high;
+    std::memcpy(&low, data, 4);
+    std::memcpy(&high, data + size - 4, 4);
+    first = low;
+    last = high;
+  } else if (size > 0) {
+    first = static_cast<unsigned char>(data[0]) |
+            static_cast<std::uint64_t>(
+                static_cast<unsigned char>(data[size / 2]))
+                << 8 |
+            static_cast<std::uint64_t>(
+                static_cast<unsigned char>(data[size - 1]))
+                << 16;
+  }
+  return mix(mix(first ^ size * 0x9e3779b97f4a7c15ull) ^ last);
+}
+
+inline std::size_t lengthBucket(std::size_t length) {
+  return std::min<std::size_t>(std::bit_width(length),
+                               ColumnProfile::LENGTH_BUCKETS - 1);
+}
+
+/** Writes text as a quoted JSON string */
+void writeString(std::ostream &out, std::string_view text) {
+  static constexpr char HEX[] = "0123456789abcdef";
+  out << '"';
+  for (char c : text) {
+    const auto byte = static_cast<unsigned char>(c);
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (byte < 0x20) {
+      out << "\\u00" << HEX[byte >> 4] << HEX[byte & 0xf];
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+
+/** Writes a number in its shortest round-trip form; null if not finite */
+template <typename T> void writeNumber(std::ostream &out, T number) {
+  if (!std::isfinite(number)) {
+    out << "null";
+    return;
+  }
+  char text[32];
+  const auto result = std::to_chars(text, text + sizeof(text), number);
+  out.write(text, result.ptr - text);
+}
+
+} // namespace
+
+void ColumnProfile::Add(std::string_view text) {
+  count(text, hashText(text));
+
+  if (!has_extremes) {
+    min_text = max_text = text;
+    has_extremes = true;
+  } else if (text < min_text) {
+    min_text = text;
+  } else if (text > max_text) {
+    max_text = text;
+  }
+}
+
+// Numbers are counted by value, so "1.50" and "1.5" are the same value
+
+void ColumnProfile::Add(std::string_view text, int number) {
+  numeric = true;
+  count(text, mix(static_cast<std::uint32_t>(number)));
+  addNumber(number);
+}
+
+void ColumnProfile::Add(std::string_view text, float number) {
+  numeric = true;
+  single_precision = true;
+  count(text, mix(std::bit_cast<std::uint32_t>(number) |
+                  std::uint64_t{1} << 32));
+  addNumber(number);
+}
+
+void ColumnProfile::count(std::string_view text, std::uint64_t hash) {
+  ++values;
+  ++lengths[lengthBucket(text.size())];
+
+  // Hash 0 marks an empty slot
+  const std::uint64_t key = hash != 0 ? hash : 1;
+
+  // Values only enter the estimate once exact counting stops; until then
+  // the tracked values are the distinct values
+  if (!exact) {
+    distinct.Add(key);
+  }
+  if (!track(key, text, 1)) {
+    if (exact) {
+      stopExactCounting();
+      distinct.Add(key);
+    }
+    // No counter is free: the value cancels one occurrence of every
+    // tracked value (Misra-Gries)
+    decrement(1);
+  }
+}
+
+bool ColumnProfile::track(std::uint64_t hash, std::string_view text,
+                          std::uint64_t count) {
+  // Slots stay at most half full, so probe sequences are short
+  if (slots.empty()) {
+    slots.resize(INITIAL_SLOTS);
+  }
+  const std::size_t mask = slots.size() - 1;
+  for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+    Slot &slot = slots[i];
+    if (slot.hash == hash) {
+      tracked[slot.index].count += count;
+      return true;
+    }
+    if (slot.hash == 0) {
+      if (tracked.size() == MAX_TRACKED_VALUES) {
+        return false;
+      }
+      slot = {hash, static_cast<std::uint32_t>(tracked.size())};
+      tracked.push_back({std::string(text), hash, count});
+      break;
+    }
+  }
+
+  if (tracked.size() * 2 > slots.size()) {
+    rebuildSlots(slots.size() * 2);
+  }
+  return true;
+}
+
+void ColumnProfile::stopExactCounting() {
+  for (const TrackedValue &value : tracked) {
+    distinct.Add(value.hash);
+  }
+  exact = false;
+}
+
+void ColumnProfile::decrement(std::uint64_t amount) {
+  undercount += amount;
+
+  std::size_t kept = 0;
+  for (std::size_t index = 0; index < tracked.size(); ++index) {
+    if (tracked[index].count > amount) {
+      tracked[index].count -= amount;
+      if (kept != index) {
+        tracked[kept] = std::move(tracked[index]);
+      }
+      ++kept;
+    }
+  }
+  tracked.resize(kept);
+
+  // Keep the table at its size; it fills up again as values arrive
+  rebuildSlots(slots.size());
+}
+
+void ColumnProfile::rebuildSlots(std::size_t size) {
+  slots.assign(size, Slot{0, 0});
+  const std::size_t mask = size - 1;
+  for (std::uint32_t index = 0; index < tracked.size(); ++index) {
+    std::size_t i = tracked[index].hash & mask;
+    while (slots[i].hash != 0) {
+      i = (i + 1) & mask;
+    }
+    slots[i] = {tracked[index].hash, index};
+  }
+}
+
+void ColumnProfile::addNumber(double number) {
+  if (std::isnan(number)) {
+    return;
+  }
+  if (!has_extremes) {
+    min_number = max_number = number;
+    has_extremes = true;
+  } else {
+    min_number = std::min(min_number, number);
+    max_number = std::max(max_number, number);
+  }
+}
+
+void ColumnProfile::Merge(const ColumnProfile &other) {
+  present = present || other.present;
+  numeric = numeric || other.numeric;
+  single_precision = single_precision || other.single_precision;
+  values += other.values;
+  nulls += other.nulls;
+  for (std::size_t bucket = 0; bucket < LENGTH_BUCKETS; ++bucket) {
+    lengths[bucket] += other.lengths[bucket];
+  }
+
+  if (other.has_extremes) {
+    if (!has_extremes) {
+      min_number = other.min_number;
+      max_number = other.max_number;
+      min_text = other.min_text;
+      max_text = other.max_text;
+      has_extremes = true;
+    } else if (numeric) {
+      min_number = std::min(min_number, other.min_number);
+      max_number = std::max(max_number, other.max_number);
+    } else {
+      min_text = std::min(min_text, other.min_text);
+      max_text = std::max(max_text, other.max_text);
+    }
+  }
+
+  // Both estimates must cover every distinct value before they merge
+  if (exact && !other.exact) {
+    stopExactCounting();
+  } else if (!exact && other.exact) {
+    for (const TrackedValue &value : other.tracked) {
+      distinct.Add(value.hash);
+    }
+  }
+  distinct.Merge(other.distinct);
+  undercount += other.undercount;
+
+  std::vector<const TrackedValue *> untracked;
+  for (const TrackedValue &value : other.tracked) {
+    if (!track(value.hash, value.text, value.count)) {
+      untracked.push_back(&value);
+    }
+  }
+  if (untracked.empty()) {
+    return;
+  }
+  if (exact) {
+    stopExactCounting();
+    for (const TrackedValue *value : untracked) {
+      distinct.Add(value->hash);
+    }
+  }
+
+  // Merged Misra-Gries summary: lower every count by the largest count
+  // past MAX_TRACKED_VALUES, which leaves at most that many values
+  std::vector<std::uint64_t> counts;
+  counts.reserve(tracked.size() + untracked.size());
+  for (const TrackedValue &value : tracked) {
+    counts.push_back(value.count);
+  }
+  for (const TrackedValue *value : untracked) {
+    counts.push_back(value->count);
+  }
+  std::nth_element(counts.begin(), counts.begin() + MAX_TRACKED_VALUES,
+                   counts.end(), std::greater<>());
+  const std::uint64_t cut = counts[MAX_TRACKED_VALUES];
+
+  decrement(cut);
+  for (const TrackedValue *value : untracked) {
+    if (value->count > cut) {
+      track(value->hash, value->text, value->count - cut);
+    }
+  }
+}
+
+void ColumnProfile::WriteJson(std::ostream &out,
+                              const std::string &indent) const {
+  const std::string inner = indent + "  ";
+  const std::uint64_t total = values + nulls;
+
+  out << indent << "{\n";
+  out << inner << "\"name\": ";
+  writeString(out, name);
+  out << ",\n" << inner << "\"present\": " << (present ? "true" : "false");
+  out << ",\n" << inner << "\"values\": " << values;
+  out << ",\n" << inner << "\"nulls\": " << nulls;
+  out << ",\n" << inner << "\"null_ratio\": ";
+  writeNumber(out, total > 0 ? static_cast<double>(nulls) /
+                                   static_cast<double>(total)
+                             : 0.0);
+
+  // Exactly counted columns know their distinct values
+  out << ",\n" << inner << "\"distinct\": "
+      << (exact ? tracked.size()
+                : static_cast<std::uint64_t>(
+                      std::llround(distinct.Estimate())));
+  out << ",\n" << inner << "\"distinct_exact\": "
+      << (exact ? "true" : "false");
+
+  out << ",\n" << inner << "\"min\": ";
+  if (!has_extremes) {
+    out << "null,\n" << inner << "\"max\": null";
+  } else if (numeric && single_precision) {
+    writeNumber(out, static_cast<float>(min_number));
+    out << ",\n" << inner << "\"max\": ";
+    writeNumber(out, static_cast<float>(max_number));
+  } else if (numeric) {
+    writeNumber(out, min_number);
+    out << ",\n" << inner << "\"max\": ";
+    writeNumber(out, max_number);
+  } else {
+    writeString(out, min_text);
+    out << ",\n" << inner << "\"max\": ";
+    writeString(out, max_text);
+  }
+
+  out << ",\n" << inner << "\"length_histogram\": {";
+  for (std::size_t bucket = 0; bucket < LENGTH_BUCKETS; ++bucket) {
+    out << (bucket > 0 ? ", " : "") << '"' << LENGTH_LABELS[bucket]
+        << "\": " << lengths[bucket];
+  }
+  out << "}";
+
+  // Counts of a high-cardinality column are short by at most undercount
+  out << ",\n" << inner << "\"top_values_undercount\": " << undercount;
+  out << ",\n" << inner << "\"top_values\": [";
+  std::vector<const TrackedValue *> top;
+  top.reserve(tracked.size());
+  for (const TrackedValue &value : tracked) {
+    top.push_back(&value);
+  }
+  const std::size_t listed = std::min(top.size(), LISTED_VALUES);
+  std::partial_sort(top.begin(), top.begin() + listed, top.end(),
+                    [](const TrackedValue *a, const TrackedValue *b) {
+                      return a->count != b->count ? a->count > b->count
+                                                  : a->text < b->text;
+                    });
+  for (std::size_t i = 0; i < listed; ++i) {
+    out << (i > 0 ? "," : "") << "\n" << inner << "  {\"value\": ";
+    writeString(out, top[i]->text);
+    out << ", \"count\": " << top[i]->count << "}";
+  }
+  out << (listed > 0 ? "\n" + inner : "") << "]";
+  out << "\n" << indent << "}";
+}
+
+TableProfile::TableProfile(std::string table,
+                           const std::vector<std::string> &columns)
+    : table(std::move(table)) {
+  this->columns.reserve(columns.size());
+  for (const std::string &column : columns) {
+    this->columns.emplace_back(column);
+  }
+}
+
+void TableProfile::Merge(const TableProfile &other) {
+  rows += other.rows;
+  rejected += other.rejected;
+  for (std::size_t i = 0; i < columns.size() && i < other.columns.size();
+       ++i) {
+    columns[i].Merge(other.columns[i]);
+  }
+}
+
+void TableProfile::WriteJson(std::ostream &out,
+                             const std::string &indent) const {
+  const std::string inner = indent + "  ";
+  out << indent << "{\n";
+  out << inner << "\"table\": ";
+  writeString(out, table);
+  out << ",\n" << inner << "\"rows\": " << rows;
+  out << ",\n" << inner << "\"rejected\": " << rejected;
+  out << ",\n" << inner << "\"columns\": [";
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    out << (i > 0 ? ",\n" : "\n");
+    columns[i].WriteJson(out, inner + "  ");
+  }
+  out << "\n" << inner << "]\n" << indent << "}";
+}
+
+void DataProfileReport::Add(const TableProfile &profile) {
+  for (TableProfile &table : tables) {
+    if (table.Table() == profile.Table()) {
+      table.Merge(profile);
+      return;
+    }
+  }
+  tables.push_back(profile);
+}
+
+bool DataProfileReport::WriteJson(const std::string &path) const {
+  std::ofstream file(path, std::ios::out | std::ios::trunc);
+  if (!file) {
+    std::cerr << "Failed to open data profile file: " << path << "\n";
+    return false;
+  }
+
+  file << "{\n  \"tables\": [";
+  for (std::size_t i = 0; i < tables.size(); ++i) {
+    file << (i > 0 ? ",\n" : "\n");
+    tables[i].WriteJson(file, "    ");
+  }
+  file << "\n  ]\n}\n";
+
+  file.flush();
+  if (!file) {
+    std::cerr << "Failed to write data profile file: " << path << "\n";
+    return false;
+  }
+  return true;
+}
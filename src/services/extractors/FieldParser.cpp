@@ -0,0 +1,189 @@
+#include "services/extractors/FieldParser.h"
+#include <charconv>
+
+namespace {
+
+std::string_view trim(std::string_view value) {
+  constexpr std::string_view whitespace = " \t\r\n";
+  const auto first = value.find_first_not_of(whitespace);
+  if (first == std::string_view::npos) {
+    return {};
+  }
+  const auto last = value.find_last_not_of(whitespace);
+  return value.substr(first, last - first + 1);
+}
+
+template <typename T> bool parseNumber(std::string_view text, T &out) {
+  const char *end = text.data() + text.size();
+  const auto [ptr, ec] = std::from_chars(text.data(), end, out);
+  return ec == std::errc() && ptr == end;
+}
+
+bool parseDigits(std::string_view text, unsigned &out) {
+  out = 0;
+  for (char c : text) {
+    if (c < '0' || c > '9') {
+      return false;
+    }
+    out = out * 10 + static_cast<unsigned>(c - '0');
+  }
+  return true;
+}
+
+/** Parses the leading YYYY-MM-DD of an ISO date or timestamp */
+bool parseDate(std::string_view text, std::chrono::year_month_day &out) {
+  unsigned y, m, d;
+  if (text.size() < 10 || text[4] != '-' || text[7] != '-' ||
+      !parseDigits(text.substr(0, 4), y) || !parseDigits(text.substr(5, 2), m) ||
+      !parseDigits(text.substr(8, 2), d)) {
+    return false;
+  }
+  out = std::chrono::year_month_day{std::chrono::year{static_cast<int>(y)},
+                                    std::chrono::month{m}, std::chrono::day{d}};
+  return out.ok();
+}
+
+} // namespace
+
+bool FieldParser::field(std::size_t column, std::string_view &value) {
+  if (!Ok() || skipped) {
+    return false;
+  }
+  if (column >= row.size()) {
+    fail(column, Failure::MissingColumn, {});
+    return false;
+  }
+  value = row[column];
+  return true;
+}
+
+void FieldParser::fail(std::size_t column, Failure reason,
+                       std::string_view value) {
+  failure = reason;
+  failed_column = column;
+  failed_value = value;
+}
+
+void FieldParser::Parse(std::size_t column, int &out) {
+  std::string_view value;
+  if (!field(column, value)) {
+    return;
+  }
+  const std::string_view text = trim(value);
+  if (text.empty()) {
+    fail(column, Failure::EmptyValue, value);
+  } else if (!parseNumber(text, out)) {
+    fail(column, Failure::InvalidInteger, value);
+  }
+}
+
+void FieldParser::Parse(std::size_t column, float &out) {
+  std::string_view value;
+  if (!field(column, value)) {
+    return;
+  }
+  const std::string_view text = trim(value);
+  if (text.empty()) {
+    fail(column, Failure::EmptyValue, value);
+  } else if (!parseNumber(text, out)) {
+    fail(column, Failure::InvalidNumber, value);
+  }
+}
+
+void FieldParser::Parse(std::size_t column, std::string &out) {
+  std::string_view value;
+  if (field(column, value)) {
+    out.assign(value);
+  }
+}
+
+void FieldParser::Parse(std::size_t column,
+                        std::chrono::year_month_day &out) {
+  std::string_view value;
+  if (!field(column, value)) {
+    return;
+  }
+  const std::string_view text = trim(value);
+  if (text.empty()) {
+    fail(column, Failure::EmptyValue, value);
+  } else if (!parseDate(text, out)) {
+    fail(column, Failure::InvalidDate, value);
+  }
+}
+
+void FieldParser::Parse(std::size_t column, std::optional<int> &out) {
+  std::string_view value;
+  if (!field(column, value)) {
+    return;
+  }
+  const std::string_view text = trim(value);
+  if (text.empty()) {
+    out.reset();
+  } else if (!parseNumber(text, out.emplace())) {
+    fail(column, Failure::InvalidInteger, value);
+  }
+}
+
+void FieldParser::Parse(std::size_t column, std::optional<float> &out) {
+  std::string_view value;
+  if (!field(column, value)) {
+    return;
+  }
+  const std::string_view text = trim(value);
+  if (text.empty()) {
+    out.reset();
+  } else if (!parseNumber(text, out.emplace())) {
+    fail(column, Failure::InvalidNumber, value);
+  }
+}
+
+void FieldParser::Parse(std::size_t column, std::optional<std::string> &out) {
+  std::string_view value;
+  if (!field(column, value)) {
+    return;
+  }
+  if (trim(value).empty()) {
+    out.reset();
+  } else if (out) {
+    out->assign(value); // Reuses the string's storage
+  } else {
+    out.emplace(value);
+  }
+}
+
+void FieldParser::Parse(std::size_t column,
+                        std::optional<std::chrono::year_month_day> &out) {
+  std::string_view value;
+  if (!field(column, value)) {
+    return;
+  }
+  std::chrono::year_month_day date;
+  if (parseDate(trim(value), date)) {
+    out = date;
+  } else {
+    out.reset();
+  }
+}
+
+std::string_view FieldParser::View(std::size_t column) {
+  std::string_view value;
+  return field(column, value) ? value : std::string_view();
+}
+
+const char *FieldParser::Describe(Failure failure) {
+  switch (failure) {
+  case Failure::None:
+    return "ok";
+  case Failure::MissingColumn:
+    return "missing column";
+  case Failure::EmptyValue:
+    return "empty value";
+  case Failure::InvalidInteger:
+    return "invalid integer";
+  case Failure::InvalidNumber:
+    return "invalid number";
+  case Failure::InvalidDate:
+    return "invalid date";
+  }
+  return "unknown";
+}
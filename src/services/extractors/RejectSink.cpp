@@ -0,0 +1,103 @@
+#include "services/extractors/RejectSink.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+
+namespace {
+
+constexpr std::size_t LOGGED_REJECTS = 5;
+constexpr std::size_t FLUSH_THRESHOLD = 1024 * 1024;
+constexpr std::size_t MAX_VALUE_LENGTH = 256;
+
+/** Appends a value as a quoted CSV field */
+void appendQuoted(std::string &out, std::string_view value) {
+  out += '"';
+  for (char c : value) {
+    if (c == '"') {
+      out += '"';
+    }
+    out += c;
+  }
+  out += '"';
+}
+
+} // namespace
+
+RejectSink::RejectSink(std::string table, std::string directory)
+    : table(std::move(table)), directory(std::move(directory)) {
+  path = (std::filesystem::path(this->directory) / (this->table + ".csv"))
+             .string();
+  label = this->table;
+  std::replace(label.begin(), label.end(), '_', ' ');
+}
+
+RejectSink::~RejectSink() { flush(); }
+
+void RejectSink::Reject(std::size_t line, std::size_t column,
+                        std::string_view reason, std::string_view value) {
+  ++count;
+
+  if (count <= LOGGED_REJECTS) {
+    std::cerr << "Rejected " << label << " row at line " << line
+              << ", column " << column << " (" << reason << ")\n";
+    if (count == LOGGED_REJECTS) {
+      std::cerr << "Further " << label << " rejects are only written to "
+                << path << "\n";
+    }
+  }
+
+  buffer += std::to_string(line);
+  buffer += ',';
+  buffer += std::to_string(column);
+  buffer += ',';
+  appendQuoted(buffer, reason);
+  buffer += ',';
+  appendQuoted(buffer, value.substr(0, MAX_VALUE_LENGTH));
+  buffer += '\n';
+
+  if (buffer.size() >= FLUSH_THRESHOLD) {
+    flush();
+  }
+}
+
+void RejectSink::Reject(std::size_t line, const FieldParser &fields) {
+  Reject(line, fields.FailedColumn(),
+         FieldParser::Describe(fields.FailureReason()), fields.FailedValue());
+}
+
+void RejectSink::Finish() {
+  flush();
+  file.flush();
+
+  if (count > 0) {
+    std::cerr << "Rejected " << count << " " << label << " rows, see " << path
+              << "\n";
+  } else {
+    // Do not leave the rejects of an earlier run behind
+    std::error_code error;
+    std::filesystem::remove(path, error);
+  }
+}
+
+void RejectSink::flush() {
+  if (buffer.empty() || file_failed) {
+    buffer.clear();
+    return;
+  }
+
+  if (!file.is_open()) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    file.open(path, std::ios::out | std::ios::trunc);
+    if (!file) {
+      std::cerr << "Failed to open reject file: " << path << "\n";
+      file_failed = true;
+      buffer.clear();
+      return;
+    }
+    file << "line,column,reason,value\n";
+  }
+
+  file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  buffer.clear();
+}
@@ -0,0 +1,166 @@
+#include "services/loaders/BatchInserter.h"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+void BatchInserter::Row::Bind(int value) {
+  if (!nextColumn()) {
+    return;
+  }
+  sqlite3_bind_int(stmt, index++, value);
+}
+
+void BatchInserter::Row::Bind(sqlite3_int64 value) {
+  if (!nextColumn()) {
+    return;
+  }
+  sqlite3_bind_int64(stmt, index++, value);
+}
+
+void BatchInserter::Row::Bind(double value) {
+  if (!nextColumn()) {
+    return;
+  }
+  sqlite3_bind_double(stmt, index++, value);
+}
+
+void BatchInserter::Row::Bind(const std::string &value) {
+  BindText(value.data(), static_cast<int>(value.size()));
+}
+
+void BatchInserter::Row::Bind(const char *value) {
+  if (value) {
+    BindText(value, -1);
+  } else {
+    BindNull();
+  }
+}
+
+void BatchInserter::Row::BindNull() {
+  if (!nextColumn()) {
+    return;
+  }
+  sqlite3_bind_null(stmt, index++);
+}
+
+void BatchInserter::Row::BindText(const char *value, int length) {
+  if (!nextColumn()) {
+    return;
+  }
+  sqlite3_bind_text(stmt, index++, value, length, SQLITE_STATIC);
+}
+
+void BatchInserter::Row::BindTextCopy(const char *value, int length) {
+  if (!nextColumn()) {
+    return;
+  }
+  sqlite3_bind_text(stmt, index++, value, length, SQLITE_TRANSIENT);
+}
+
+char *BatchInserter::Row::Scratch(std::size_t size) {
+  if (scratchUsed + size > SCRATCH_BYTES_PER_ROW) {
+    return nullptr;
+  }
+  char *storage = scratch + scratchUsed;
+  scratchUsed += size;
+  return storage;
+}
+
+BatchInserter::BatchInserter(sqlite3 *db, const std::string &table,
+                             const std::vector<std::string> &columns,
+                             std::size_t totalRows,
+                             const std::unordered_set<std::string> &excluded)
+    : db(db), table(table), remaining(totalRows) {
+  for (const std::string &column : columns) {
+    const bool insert = excluded.count(column) == 0;
+    included.push_back(insert);
+    if (insert) {
+      this->columns.push_back(column);
+    }
+  }
+
+  // As many rows as the connection's variable limit allows
+  const int variableLimit = sqlite3_limit(db, SQLITE_LIMIT_VARIABLE_NUMBER, -1);
+  const std::size_t columnCount =
+      std::max<std::size_t>(this->columns.size(), 1);
+  rowsPerStatement = std::clamp<std::size_t>(
+      static_cast<std::size_t>(std::max(variableLimit, 1)) / columnCount, 1,
+      MAX_ROWS_PER_STATEMENT);
+
+  batchRows = std::min(rowsPerStatement, std::max<std::size_t>(totalRows, 1));
+  stmt = prepare(batchRows);
+  current = stmt;
+  scratch.resize(batchRows * SCRATCH_BYTES_PER_ROW);
+}
+
+BatchInserter::~BatchInserter() {
+  if (tailStmt) {
+    sqlite3_finalize(tailStmt);
+  }
+  if (stmt) {
+    sqlite3_finalize(stmt);
+  }
+}
+
+sqlite3_stmt *BatchInserter::prepare(std::size_t rows) const {
+  std::stringstream sql;
+  sql << "INSERT INTO " << table << " (";
+
+  // Add column names
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    sql << (i ? ", " : "") << columns[i];
+  }
+
+  sql << ") VALUES ";
+
+  // Add one group of placeholders per row
+  for (std::size_t row = 0; row < rows; ++row) {
+    sql << (row ? ",(" : "(");
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+      sql << (i ? ",?" : "?");
+    }
+    sql << ")";
+  }
+
+  const std::string text = sql.str();
+  sqlite3_stmt *prepared = nullptr;
+  if (sqlite3_prepare_v2(db, text.c_str(), static_cast<int>(text.size()),
+                         &prepared, nullptr) != SQLITE_OK) {
+    std::cerr << "SQLite error preparing insert into " << table << ": "
+              << sqlite3_errmsg(db) << std::endl;
+    return nullptr;
+  }
+  return prepared;
+}
+
+BatchInserter::Row BatchInserter::NextRow() {
+  // The rows left over after the last full batch get a statement of their own
+  if (pending == 0 && remaining < batchRows && remaining > 0) {
+    if (tailStmt) {
+      sqlite3_finalize(tailStmt);
+    }
+    tailStmt = prepare(remaining);
+    current = tailStmt;
+    batchRows = remaining;
+  }
+
+  const int index = static_cast<int>(pending * columns.size()) + 1;
+  return Row(current, index, scratch.data() + pending * SCRATCH_BYTES_PER_ROW,
+             included);
+}
+
+bool BatchInserter::EndRow() {
+  --remaining;
+  if (++pending < batchRows) {
+    return true;
+  }
+
+  pending = 0;
+  if (!current) {
+    return false;
+  }
+
+  const int rc = sqlite3_step(current);
+  sqlite3_reset(current);
+  return rc == SQLITE_DONE;
+}
@@ -0,0 +1,62 @@
+#include "services/loaders/GtinIndexFileLoaderService.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+GtinIndexFileLoaderService::GtinIndexFileLoaderService(
+    const std::string &filePath)
+    : filePath(filePath) {}
+
+bool GtinIndexFileLoaderService::LoadGtinIndex(
+    const std::vector<USDA::GtinIndexEntry> &gtin_index_entries) {
+  // Write to a temporary file first so readers never map a partial index
+  const std::string tempPath = filePath + ".tmp";
+
+  std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    std::cerr << "Cannot open GTIN index file: " << tempPath << std::endl;
+    return false;
+  }
+
+  char header[HEADER_SIZE] = {};
+  const std::uint32_t version = FORMAT_VERSION;
+  const std::uint64_t count = gtin_index_entries.size();
+  std::memcpy(header, "USDAGTIN", 8);
+  std::memcpy(header + 8, &version, sizeof(version));
+  std::memcpy(header + 16, &count, sizeof(count));
+  out.write(header, sizeof(header));
+
+  // Split the entries into the key and value arrays
+  std::vector<std::uint64_t> gtins;
+  std::vector<std::int32_t> fdc_ids;
+  gtins.reserve(gtin_index_entries.size());
+  fdc_ids.reserve(gtin_index_entries.size());
+  for (const auto &entry : gtin_index_entries) {
+    gtins.push_back(entry.gtin);
+    fdc_ids.push_back(entry.fdc_id);
+  }
+
+  out.write(reinterpret_cast<const char *>(gtins.data()),
+            static_cast<std::streamsize>(gtins.size() * sizeof(std::uint64_t)));
+  out.write(reinterpret_cast<const char *>(fdc_ids.data()),
+            static_cast<std::streamsize>(fdc_ids.size() * sizeof(std::int32_t)));
+  out.close();
+
+  if (!out) {
+    std::cerr << "Failed to write GTIN index file: " << tempPath << std::endl;
+    std::remove(tempPath.c_str());
+    return false;
+  }
+
+  if (std::rename(tempPath.c_str(), filePath.c_str()) != 0) {
+    std::cerr << "Failed to move GTIN index file into place: " << filePath
+              << std::endl;
+    std::remove(tempPath.c_str());
+    return false;
+  }
+
+  std::cout << "Successfully wrote " << count << " GTIN index entries to "
+            << filePath << std::endl;
+  return true;
+}
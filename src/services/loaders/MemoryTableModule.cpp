@@ -0,0 +1,344 @@
+#include "services/loaders/MemoryTableModule.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+/** Constraint operators on fdc_id, as bits of the index number */
+enum IndexFlags : int {
+  FDC_ID_EQ = 1,
+  FDC_ID_GT = 2,
+  FDC_ID_GE = 4,
+  FDC_ID_LT = 8,
+  FDC_ID_LE = 16,
+  FDC_ID_ORDERED = 32 ///< Rows are produced in fdc_id order
+};
+
+/** Constraint operators handled by xBestIndex, in argument order */
+constexpr std::pair<unsigned char, int> FDC_ID_OPERATORS[] = {
+    {SQLITE_INDEX_CONSTRAINT_EQ, FDC_ID_EQ},
+    {SQLITE_INDEX_CONSTRAINT_GT, FDC_ID_GT},
+    {SQLITE_INDEX_CONSTRAINT_GE, FDC_ID_GE},
+    {SQLITE_INDEX_CONSTRAINT_LT, FDC_ID_LT},
+    {SQLITE_INDEX_CONSTRAINT_LE, FDC_ID_LE}};
+
+struct MemoryVtab {
+  sqlite3_vtab base; ///< Must be first, SQLite casts to it
+  MemoryTable *table;
+};
+
+struct MemoryCursor {
+  sqlite3_vtab_cursor base; ///< Must be first, SQLite casts to it
+  MemoryTable *table;
+  const std::vector<std::uint32_t> *order; ///< nullptr: position is the row
+  std::size_t position;
+  std::size_t end;
+};
+
+int connectTable(sqlite3 *db, void *aux, int argc, const char *const *argv,
+                 sqlite3_vtab **vtab, char **error) {
+  // argv: module name, database name, table name, module arguments
+  if (argc != 4) {
+    *error = sqlite3_mprintf("%s takes the name of one extracted table",
+                             MemoryTableModule::MODULE_NAME);
+    return SQLITE_ERROR;
+  }
+
+  auto *module = static_cast<MemoryTableModule *>(aux);
+  MemoryTable *table = module->Find(argv[3]);
+  if (!table) {
+    *error = sqlite3_mprintf("no extracted table named '%s'", argv[3]);
+    return SQLITE_ERROR;
+  }
+
+  int rc = sqlite3_declare_vtab(db, table->Declaration().c_str());
+  if (rc != SQLITE_OK) {
+    return rc;
+  }
+
+  auto *memory_vtab = new MemoryVtab{};
+  memory_vtab->table = table;
+  *vtab = &memory_vtab->base;
+  return SQLITE_OK;
+}
+
+int disconnectTable(sqlite3_vtab *vtab) {
+  delete reinterpret_cast<MemoryVtab *>(vtab);
+  return SQLITE_OK;
+}
+
+int bestIndex(sqlite3_vtab *vtab, sqlite3_index_info *info) {
+  MemoryTable *table = reinterpret_cast<MemoryVtab *>(vtab)->table;
+  const int fdc_id_column = table->FdcIdColumn();
+  const double rows =
+      static_cast<double>(std::max<std::size_t>(table->Size(), 1));
+
+  int flags = 0;
+  int argument = 0;
+  for (const auto &[op, flag] : FDC_ID_OPERATORS) {
+    for (int i = 0; i < info->nConstraint; ++i) {
+      const auto &constraint = info->aConstraint[i];
+      if (!constraint.usable || constraint.iColumn != fdc_id_column ||
+          constraint.op != op || fdc_id_column < 0) {
+        continue;
+      }
+      // SQLite still checks the constraint, so the bounds only need to
+      // cover the matching rows
+      info->aConstraintUsage[i].argvIndex = ++argument;
+      flags |= flag;
+      break;
+    }
+  }
+
+  if (info->nOrderBy == 1 && fdc_id_column >= 0 &&
+      info->aOrderBy[0].iColumn == fdc_id_column && !info->aOrderBy[0].desc) {
+    flags |= FDC_ID_ORDERED;
+    info->orderByConsumed = 1;
+  }
+
+  double estimated_rows = rows;
+  if (flags & FDC_ID_EQ) {
+    estimated_rows = std::min(rows, 25.0);
+  } else if ((flags & (FDC_ID_GT | FDC_ID_GE)) &&
+             (flags & (FDC_ID_LT | FDC_ID_LE))) {
+    estimated_rows = rows / 10;
+  } else if (flags & (FDC_ID_GT | FDC_ID_GE | FDC_ID_LT | FDC_ID_LE)) {
+    estimated_rows = rows / 3;
+  }
+
+  info->idxNum = flags;
+  info->estimatedRows = static_cast<sqlite3_int64>(estimated_rows);
+  info->estimatedCost =
+      (flags & ~FDC_ID_ORDERED) ? std::log2(rows) + estimated_rows : rows;
+  return SQLITE_OK;
+}
+
+int openCursor(sqlite3_vtab *vtab, sqlite3_vtab_cursor **cursor) {
+  auto *memory_cursor = new MemoryCursor{};
+  memory_cursor->table = reinterpret_cast<MemoryVtab *>(vtab)->table;
+  *cursor = &memory_cursor->base;
+  return SQLITE_OK;
+}
+
+int closeCursor(sqlite3_vtab_cursor *cursor) {
+  delete reinterpret_cast<MemoryCursor *>(cursor);
+  return SQLITE_OK;
+}
+
+int filterRows(sqlite3_vtab_cursor *base, int flags, const char *, int argc,
+               sqlite3_value **argv) {
+  auto *cursor = reinterpret_cast<MemoryCursor *>(base);
+  MemoryTable *table = cursor->table;
+
+  cursor->order = nullptr;
+  cursor->position = 0;
+  cursor->end = table->Size();
+  if (flags == 0) {
+    return SQLITE_OK;
+  }
+
+  cursor->order = table->FdcIdOrder();
+  const std::vector<std::uint32_t> *order = cursor->order;
+  auto fdcIdAt = [table, order](std::size_t position) {
+    return static_cast<double>(
+        table->FdcId(order ? (*order)[position] : position));
+  };
+
+  // Narrow [position, end) of the fdc_id order with each bound in turn
+  int argument = 0;
+  for (const auto &[op, flag] : FDC_ID_OPERATORS) {
+    if (!(flags & flag) || argument >= argc) {
+      continue;
+    }
+    sqlite3_value *value = argv[argument++];
+    const int type = sqlite3_value_numeric_type(value);
+    if (type == SQLITE_NULL) {
+      // Comparisons with NULL match nothing
+      cursor->end = cursor->position;
+      return SQLITE_OK;
+    }
+    if (type != SQLITE_INTEGER && type != SQLITE_FLOAT) {
+      // Left to SQLite's own comparison
+      continue;
+    }
+    const double bound = sqlite3_value_double(value);
+
+    auto first = [&](auto predicate) {
+      std::size_t low = cursor->position;
+      std::size_t high = cursor->end;
+      while (low < high) {
+        const std::size_t middle = low + (high - low) / 2;
+        if (predicate(fdcIdAt(middle))) {
+          low = middle + 1;
+        } else {
+          high = middle;
+        }
+      }
+      return low;
+    };
+    const auto below = [bound](double id) { return id < bound; };
+    const auto not_above = [bound](double id) { return id <= bound; };
+
+    if (flag == FDC_ID_EQ) {
+      const std::size_t begin = first(below);
+      cursor->end = first(not_above);
+      cursor->position = begin;
+    } else if (flag == FDC_ID_GT) {
+      cursor->position = first(not_above);
+    } else if (flag == FDC_ID_GE) {
+      cursor->position = first(below);
+    } else if (flag == FDC_ID_LT) {
+      cursor->end = first(below);
+    } else {
+      cursor->end = first(not_above);
+    }
+    cursor->end = std::max(cursor->end, cursor->position);
+  }
+  return SQLITE_OK;
+}
+
+int nextRow(sqlite3_vtab_cursor *base) {
+  ++reinterpret_cast<MemoryCursor *>(base)->position;
+  return SQLITE_OK;
+}
+
+int atEnd(sqlite3_vtab_cursor *base) {
+  auto *cursor = reinterpret_cast<MemoryCursor *>(base);
+  return cursor->position >= cursor->end;
+}
+
+std::size_t currentRow(const MemoryCursor *cursor) {
+  return cursor->order ? (*cursor->order)[cursor->position]
+                       : cursor->position;
+}
+
+int columnValue(sqlite3_vtab_cursor *base, sqlite3_context *context,
+                int index) {
+  auto *cursor = reinterpret_cast<MemoryCursor *>(base);
+  cursor->table->Result(context, currentRow(cursor), index);
+  return SQLITE_OK;
+}
+
+int rowId(sqlite3_vtab_cursor *base, sqlite3_int64 *id) {
+  *id = static_cast<sqlite3_int64>(
+      currentRow(reinterpret_cast<MemoryCursor *>(base)));
+  return SQLITE_OK;
+}
+
+/** The module's callbacks; tables are read-only, so xUpdate is not set */
+sqlite3_module makeModule() {
+  sqlite3_module module{};
+  module.iVersion = 1;
+  module.xCreate = connectTable;
+  module.xConnect = connectTable;
+  module.xBestIndex = bestIndex;
+  module.xDisconnect = disconnectTable;
+  module.xDestroy = disconnectTable;
+  module.xOpen = openCursor;
+  module.xClose = closeCursor;
+  module.xFilter = filterRows;
+  module.xNext = nextRow;
+  module.xEof = atEnd;
+  module.xColumn = columnValue;
+  module.xRowid = rowId;
+  return module;
+}
+
+const sqlite3_module MODULE = makeModule();
+
+} // namespace
+
+const std::vector<std::uint32_t> *MemoryTable::FdcIdOrder() {
+  if (!order_checked) {
+    order_checked = true;
+    const std::size_t size = Size();
+
+    ordered = true;
+    for (std::size_t row = 1; row < size && ordered; ++row) {
+      ordered = FdcId(row - 1) <= FdcId(row);
+    }
+
+    if (!ordered) {
+      order.resize(size);
+      for (std::size_t row = 0; row < size; ++row) {
+        order[row] = static_cast<std::uint32_t>(row);
+      }
+      std::stable_sort(order.begin(), order.end(),
+                       [this](std::uint32_t a, std::uint32_t b) {
+                         return FdcId(a) < FdcId(b);
+                       });
+    }
+  }
+  return ordered ? nullptr : &order;
+}
+
+void MemoryTable::Result(sqlite3_context *context, int value) {
+  sqlite3_result_int(context, value);
+}
+
+void MemoryTable::Result(sqlite3_context *context, float value) {
+  sqlite3_result_double(context, static_cast<double>(value));
+}
+
+void MemoryTable::Result(sqlite3_context *context, double value) {
+  sqlite3_result_double(context, value);
+}
+
+void MemoryTable::Result(sqlite3_context *context, const std::string &value) {
+  // The model outlives the statement, so the text is not copied
+  sqlite3_result_text(context, value.data(), static_cast<int>(value.size()),
+                      SQLITE_STATIC);
+}
+
+void MemoryTable::Result(sqlite3_context *context,
+                         const std::chrono::year_month_day &value) {
+  char text[16];
+  const int length = std::snprintf(
+      text, sizeof(text), "%04d-%02u-%02u", static_cast<int>(value.year()),
+      static_cast<unsigned>(value.month()), static_cast<unsigned>(value.day()));
+  sqlite3_result_text(context, text, length, SQLITE_TRANSIENT);
+}
+
+void MemoryTable::Result(sqlite3_context *context, USDA::FoodDataType value) {
+  sqlite3_result_text(context, USDA::DataTypeName(value), -1, SQLITE_STATIC);
+}
+
+bool MemoryTableModule::Register(sqlite3 *db) {
+  if (!db) {
+    return false;
+  }
+
+  int rc = sqlite3_create_module_v2(db, MODULE_NAME, &MODULE, this, nullptr);
+  if (rc != SQLITE_OK) {
+    std::cerr << "Error registering " << MODULE_NAME
+              << " module: " << sqlite3_errmsg(db) << std::endl;
+    return false;
+  }
+
+  bool success = true;
+  for (const auto &table : tables) {
+    const std::string sql = std::string("CREATE VIRTUAL TABLE temp.v_") +
+                            table->Name() + " USING " + MODULE_NAME + "(" +
+                            table->Name() + ")";
+    char *errMsg = nullptr;
+    if (sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &errMsg) !=
+        SQLITE_OK) {
+      std::cerr << "Error creating v_" << table->Name() << ": " << errMsg
+                << std::endl;
+      sqlite3_free(errMsg);
+      success = false;
+    }
+  }
+  return success;
+}
+
+MemoryTable *MemoryTableModule::Find(const std::string &name) const {
+  for (const auto &table : tables) {
+    if (name == table->Name()) {
+      return table.get();
+    }
+  }
+  return nullptr;
+}
@@ -1,8 +1,102 @@
 #include "services/loaders/SQLiteLoaderService.h"
+#include <algorithm>
+#include <cstdio>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <sstream>
+#include <string_view>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+/** A secondary index created after the bulk load */
+struct SecondaryIndex {
+  const char *name;
+  const char *table;
+  const char *columns;
+  const char *covering; ///< Columns appended in the compact profile, or null
+};
+
+/** Indexes on the foreign-key and lookup columns queried by consumers */
+constexpr SecondaryIndex SECONDARY_INDEXES[] = {
+    {"foods_food_category_id", "foods", "food_category_id", "description"},
+    {"branded_foods_gtin_upc", "branded_foods", "gtin_upc", nullptr},
+    {"food_nutrients_fdc_id", "food_nutrients", "fdc_id",
+     "nutrient_id, amount"},
+    {"food_nutrients_nutrient_id", "food_nutrients", "nutrient_id", "amount"},
+    {"food_portions_fdc_id", "food_portions", "fdc_id",
+     "seq_num, amount, measure_unit_id, gram_weight"},
+    {"food_portions_measure_unit_id", "food_portions", "measure_unit_id",
+     nullptr},
+    {"branded_food_ingredients_ingredient_id", "branded_food_ingredients",
+     "ingredient_id, fdc_id", nullptr},
+    {"gtin_index_fdc_id", "gtin_index", "fdc_id", nullptr},
+    {"food_attributes_fdc_id", "food_attributes", "fdc_id", nullptr},
+    {"input_foods_fdc_id", "input_foods", "fdc_id", nullptr},
+    {"survey_fndds_foods_food_code", "survey_fndds_foods", "food_code",
+     nullptr},
+};
+
+/** Lookup table of a repeated branded_foods column */
+struct DimensionTable {
+  const char *column; ///< Column of branded_food.csv ("brand_owner")
+  const char *table;  ///< Lookup table, referenced by <column>_id
+  const char *label;  ///< Name of one row in progress messages
+};
+
+constexpr DimensionTable DIMENSION_TABLES[] = {
+    {"brand_owner", "brand_owners", "brand owner"},
+    {"branded_food_category", "branded_food_categories",
+     "branded food category"},
+    {"data_source", "data_sources", "data source"},
+    {"market_country", "market_countries", "market country"},
+    {"serving_size_unit", "serving_size_units", "serving size unit"}};
+
+/** Binds a lookup table key; 0 marks a missing value */
+void bindKey(BatchInserter::Row &row, int id) {
+  if (id != 0) {
+    row.Bind(id);
+  } else {
+    row.BindNull();
+  }
+}
+
+/** Writes `digits` decimal digits of value, zero padded */
+char *writeDigits(char *out, unsigned value, int digits) {
+  for (int i = digits - 1; i >= 0; --i) {
+    out[i] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+  return out + digits;
+}
+
+/** Formats an ISO date (YYYY-MM-DD) without allocating; returns its length */
+int formatIsoDate(const std::chrono::year_month_day &date, char *out,
+                  std::size_t size) {
+  const int year = static_cast<int>(date.year());
+  const unsigned month = static_cast<unsigned>(date.month());
+  const unsigned day = static_cast<unsigned>(date.day());
+
+  if (year < 0 || year > 9999) {
+    return std::snprintf(out, size, "%d-%02u-%02u", year, month, day);
+  }
+
+  char *end = writeDigits(out, static_cast<unsigned>(year), 4);
+  *end++ = '-';
+  end = writeDigits(end, month, 2);
+  *end++ = '-';
+  end = writeDigits(end, day, 2);
+  return static_cast<int>(end - out);
+}
+
+} // namespace
 
-SQLiteLoaderService::SQLiteLoaderService(const std::string &dbPath) {
+SQLiteLoaderService::SQLiteLoaderService(const std::string &dbPath,
+                                         DateFormat dateFormat)
+    : dateFormat(dateFormat) {
   int rc = sqlite3_open(dbPath.c_str(), &db);
   if (rc != SQLITE_OK) {
     std::cerr << "Cannot open database: " << sqlite3_errmsg(db) << std::endl;
@@ -30,93 +124,479 @@ bool SQLiteLoaderService::Initialize() {
   return createTables();
 }
 
-bool SQLiteLoaderService::createTables() {
-  if (!db)
-    return false;
+std::vector<std::pair<std::string, std::string>>
+SQLiteLoaderService::tableDefinitions() const {
+  const std::string dateType = dateColumnType();
 
-  // Create foods table if it doesn't exit
-  if (!tableExists("foods")) {
-    const char *sql = R"SQL(
+  std::vector<std::pair<std::string, std::string>> definitions = {
+      // food_category_id is the numeric key of the food's category, so
+      // INTEGER affinity stores it as an integer instead of text
+      {"foods", R"SQL(
             CREATE TABLE foods (
                 fdc_id INTEGER PRIMARY KEY,
                 data_type TEXT,
                 description TEXT,
-                food_category_id TEXT,
-                publication_date TEXT
-            ))SQL";
+                food_category_id INTEGER,
+                publication_date )SQL" + dateType + R"SQL(
+            ))SQL"},
 
-    char *errMsg = nullptr;
-    int rc = sqlite3_exec(db, sql, nullptr, nullptr, &errMsg);
-
-    if (rc != SQLITE_OK) {
-      std::cerr << "Error creating foods table: " << errMsg << std::endl;
-      sqlite3_free(errMsg);
-      return false;
-    }
-  }
-
-  // Create branded_foods table if it doesn't exist
-  if (!tableExists("branded_foods")) {
-    const char *sql = R"SQL(
+      // Repeated text columns are keys into lookup tables (see
+      // DIMENSION_TABLES), so each distinct value is stored once
+      {"branded_foods", R"SQL(
             CREATE TABLE branded_foods (
                 fdc_id INTEGER PRIMARY KEY,
-                brand_owner TEXT,
+                brand_owner_id INTEGER REFERENCES brand_owners (id),
                 brand_name TEXT,
                 subbrand_name TEXT,
                 gtin_upc TEXT,
                 ingredients TEXT,
                 not_a_significant_source_of TEXT,
                 serving_size REAL,
-                serving_size_unit TEXT,
+                serving_size_unit_id INTEGER
+                    REFERENCES serving_size_units (id),
                 household_serving_fulltext TEXT,
-                branded_food_category TEXT,
-                data_source TEXT,
+                branded_food_category_id INTEGER
+                    REFERENCES branded_food_categories (id),
+                data_source_id INTEGER REFERENCES data_sources (id),
                 package_weight TEXT,
-                modified_date TEXT,
-                available_date TEXT,
-                discontinued_date TEXT,
-                market_country TEXT,
+                modified_date )SQL" + dateType + R"SQL(,
+                available_date )SQL" + dateType + R"SQL(,
+                discontinued_date )SQL" + dateType + R"SQL(,
+                market_country_id INTEGER REFERENCES market_countries (id),
                 preparation_state_code TEXT,
                 trade_channel TEXT,
                 short_description TEXT,
                 material_code TEXT
             )
-        )SQL";
-
-    char *errMsg = nullptr;
-    int rc = sqlite3_exec(db, sql, nullptr, nullptr, &errMsg);
-
-    if (rc != SQLITE_OK) {
-      std::cerr << "Error creating branded_foods table: " << errMsg
-                << std::endl;
-      sqlite3_free(errMsg);
-      return false;
-    }
-  }
+        )SQL"},
 
-  if (!tableExists("food_catgories")) {
-    const char *sql = R"SQL(
+      {"food_categories", R"SQL(
             CREATE TABLE food_categories (
                 id INTEGER PRIMARY KEY,
                 code INTEGER,
                 description TEXT
             )
+        )SQL"},
+
+      // Barcode lookup table, clustered on the GTIN so no rowid B-tree is
+      // needed
+      {"gtin_index", R"SQL(
+            CREATE TABLE gtin_index (
+                gtin INTEGER NOT NULL,
+                fdc_id INTEGER NOT NULL,
+                PRIMARY KEY (gtin, fdc_id)
+            ) WITHOUT ROWID
+        )SQL"},
+
+      {"nutrients", R"SQL(
+            CREATE TABLE nutrients (
+                id INTEGER PRIMARY KEY,
+                name TEXT,
+                unit_name TEXT,
+                nutrient_nbr TEXT,
+                rank INTEGER
+            )
+        )SQL"},
+
+      {"measure_units", R"SQL(
+            CREATE TABLE measure_units (
+                id INTEGER PRIMARY KEY,
+                name TEXT,
+                unit TEXT
+            )
+        )SQL"},
+
+      {"food_nutrients", R"SQL(
+            CREATE TABLE food_nutrients (
+                id INTEGER PRIMARY KEY,
+                fdc_id INTEGER,
+                nutrient_id INTEGER,
+                amount REAL,
+                amount_per_serving REAL,
+                data_points INTEGER,
+                derivation_id TEXT,
+                min REAL,
+                max REAL,
+                median REAL,
+                loq REAL,
+                footnote TEXT,
+                min_year_acquired INTEGER,
+                percent_daily_value REAL
+            )
+        )SQL"},
+
+      {"food_portions", R"SQL(
+            CREATE TABLE food_portions (
+                id INTEGER PRIMARY KEY,
+                fdc_id INTEGER,
+                seq_num INTEGER,
+                amount REAL,
+                measure_unit_id INTEGER,
+                portion_description TEXT,
+                modifier TEXT,
+                gram_weight REAL,
+                data_points INTEGER,
+                footnote TEXT,
+                min_year_acquired INTEGER
+            )
+        )SQL"},
+
+      {"ingredients", R"SQL(
+            CREATE TABLE ingredients (
+                id INTEGER PRIMARY KEY,
+                name TEXT NOT NULL UNIQUE
+            )
+        )SQL"},
+
+      // Clustered by product; the ingredient index built by BuildIndexes()
+      // turns "contains X" queries into an integer range scan
+      {"branded_food_ingredients", R"SQL(
+            CREATE TABLE branded_food_ingredients (
+                fdc_id INTEGER NOT NULL,
+                ingredient_id INTEGER NOT NULL,
+                position INTEGER NOT NULL,
+                PRIMARY KEY (fdc_id, position)
+            ) WITHOUT ROWID
+        )SQL"},
+
+      // One row per (category, nutrient), so "compared to similar foods"
+      // lookups are a single primary key search
+      {"nutrient_category_stats", R"SQL(
+            CREATE TABLE nutrient_category_stats (
+                category_type TEXT NOT NULL,
+                category TEXT NOT NULL,
+                nutrient_id INTEGER NOT NULL,
+                food_count INTEGER,
+                mean REAL,
+                p10 REAL,
+                median REAL,
+                p90 REAL,
+                PRIMARY KEY (category_type, category, nutrient_id)
+            ) WITHOUT ROWID
+        )SQL"},
+
+      {"food_attributes", R"SQL(
+            CREATE TABLE food_attributes (
+                id INTEGER PRIMARY KEY,
+                fdc_id INTEGER,
+                seq_num INTEGER,
+                food_attribute_type_id INTEGER,
+                name TEXT,
+                value TEXT
+            )
+        )SQL"},
+
+      {"input_foods", R"SQL(
+            CREATE TABLE input_foods (
+                id INTEGER PRIMARY KEY,
+                fdc_id INTEGER,
+                fdc_id_of_input_food INTEGER,
+                seq_num INTEGER,
+                amount REAL,
+                sr_code INTEGER,
+                sr_description TEXT,
+                unit TEXT,
+                portion_code TEXT,
+                portion_description TEXT,
+                gram_weight REAL,
+                retention_code INTEGER
+            )
+        )SQL"},
+
+      {"survey_fndds_foods", R"SQL(
+            CREATE TABLE survey_fndds_foods (
+                fdc_id INTEGER PRIMARY KEY,
+                food_code INTEGER,
+                wweia_category_code INTEGER,
+                start_date )SQL" + dateType + R"SQL(,
+                end_date )SQL" + dateType + R"SQL(
+            )
+        )SQL"},
+  };
+
+  for (const DimensionTable &dimension : DIMENSION_TABLES) {
+    definitions.emplace_back(dimension.table,
+                             std::string("CREATE TABLE ") + dimension.table +
+                                 R"SQL( (
+                id INTEGER PRIMARY KEY,
+                name TEXT NOT NULL UNIQUE
+            ))SQL");
+  }
+  return definitions;
+}
+
+bool SQLiteLoaderService::createTables() {
+  if (!db)
+    return false;
+
+  // Load progress of every table, committed together with its rows
+  if (!tableExists("etl_checkpoints")) {
+    const char *sql = R"SQL(
+            CREATE TABLE etl_checkpoints (
+                table_name TEXT PRIMARY KEY,
+                fingerprint TEXT NOT NULL,
+                total_rows INTEGER NOT NULL,
+                rows_committed INTEGER NOT NULL
+            )
         )SQL";
 
     char *errMsg = nullptr;
     int rc = sqlite3_exec(db, sql, nullptr, nullptr, &errMsg);
 
     if (rc != SQLITE_OK) {
-      std::cerr << "Error creating food_categories table: " << errMsg
+      std::cerr << "Error creating etl_checkpoints table: " << errMsg
                 << std::endl;
       sqlite3_free(errMsg);
       return false;
     }
   }
 
+  for (const auto &[table, sql] : tableDefinitions()) {
+    // Tables left out of the profile are never materialized
+    if (excludedTables.count(table)) {
+      if (!executeStatement("DROP TABLE IF EXISTS " + table,
+                            "dropping " + table + " table") ||
+          !clearCheckpoint(table)) {
+        return false;
+      }
+      continue;
+    }
+
+    if (!tableExists(table) && !createTable(table, sql)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool SQLiteLoaderService::createTable(const std::string &table,
+                                      const std::string &sql) {
+  char *errMsg = nullptr;
+  int rc = sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &errMsg);
+
+  if (rc != SQLITE_OK) {
+    std::cerr << "Error creating " << table << " table: " << errMsg
+              << std::endl;
+    sqlite3_free(errMsg);
+    return false;
+  }
+
+  // Progress recorded for an earlier copy of the table no longer applies
+  if (!clearCheckpoint(table)) {
+    return false;
+  }
+
+  // Columns left out of the profile are dropped while the table is empty
+  auto excluded = excludedColumns.find(table);
+  if (excluded == excludedColumns.end()) {
+    return true;
+  }
+
+  for (const std::string &column : excluded->second) {
+    if (!executeStatement("ALTER TABLE " + table + " DROP COLUMN " + column,
+                          "dropping column " + table + "." + column)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool SQLiteLoaderService::recreateTable(const std::string &table) {
+  for (const auto &[name, sql] : tableDefinitions()) {
+    if (name == table) {
+      return executeStatement("DROP TABLE IF EXISTS " + table,
+                              "dropping " + table + " table") &&
+             createTable(table, sql);
+    }
+  }
+
+  // Not one of the loaded tables: keep it and clear its rows
+  return executeStatement("DELETE FROM " + table, "clearing " + table);
+}
+
+void SQLiteLoaderService::ExcludeTable(const std::string &table) {
+  excludedTables.insert(table);
+
+  // Lookup tables only exist for the rows that reference them
+  if (table == "branded_foods") {
+    for (const DimensionTable &dimension : DIMENSION_TABLES) {
+      excludedTables.insert(dimension.table);
+    }
+  }
+}
+
+void SQLiteLoaderService::ExcludeColumns(
+    const std::string &table, const std::unordered_set<std::string> &columns) {
+  if (columns.empty()) {
+    excludedColumns.erase(table);
+    return;
+  }
+
+  // A repeated column is stored as <column>_id plus its lookup table
+  std::unordered_set<std::string> excluded = columns;
+  if (table == "branded_foods") {
+    for (const DimensionTable &dimension : DIMENSION_TABLES) {
+      if (excluded.erase(dimension.column)) {
+        excluded.insert(std::string(dimension.column) + "_id");
+        excludedTables.insert(dimension.table);
+      }
+    }
+  }
+  excludedColumns[table] = std::move(excluded);
+}
+
+void SQLiteLoaderService::EnableCheckpoints(const std::string &fingerprint) {
+  checkpointFingerprint = fingerprint;
+}
+
+void SQLiteLoaderService::SetOutputProfile(OutputProfile profile) {
+  outputProfile = profile;
+}
+
+bool SQLiteLoaderService::startCheckpoint(const std::string &table,
+                                          std::size_t totalRows,
+                                          std::size_t &resumeRow) {
+  resumeRow = 0;
+
+  sqlite3_stmt *stmt;
+  int rc = sqlite3_prepare_v2(db,
+                              "SELECT fingerprint, total_rows, rows_committed "
+                              "FROM etl_checkpoints WHERE table_name = ?",
+                              -1, &stmt, nullptr);
+  if (rc != SQLITE_OK) {
+    logError("Preparing checkpoint query");
+    return false;
+  }
+
+  sqlite3_bind_text(stmt, 1, table.data(), static_cast<int>(table.size()),
+                    SQLITE_STATIC);
+
+  // Resume only a load of the same inputs into the same number of rows
+  if (sqlite3_step(stmt) == SQLITE_ROW) {
+    const auto *fingerprint =
+        reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0));
+    const sqlite3_int64 total = sqlite3_column_int64(stmt, 1);
+    const sqlite3_int64 committed = sqlite3_column_int64(stmt, 2);
+
+    if (fingerprint && checkpointFingerprint == fingerprint &&
+        total == static_cast<sqlite3_int64>(totalRows) && committed > 0 &&
+        committed <= total) {
+      resumeRow = static_cast<std::size_t>(committed);
+    }
+  }
+  finalizeStatement(stmt);
+
+  if (resumeRow > 0) {
+    return true;
+  }
+
+  // Starting over: recreate the table, dropping rows left by an earlier
+  // load of different inputs and applying the current column projection
+  beginTransaction();
+
+  if (!recreateTable(table)) {
+    rollbackTransaction();
+    return false;
+  }
+
+  rc = sqlite3_prepare_v2(db,
+                          "INSERT OR REPLACE INTO etl_checkpoints (table_name, "
+                          "fingerprint, total_rows, rows_committed) "
+                          "VALUES (?, ?, ?, 0)",
+                          -1, &stmt, nullptr);
+  if (rc != SQLITE_OK) {
+    logError("Preparing checkpoint reset");
+    rollbackTransaction();
+    return false;
+  }
+
+  sqlite3_bind_text(stmt, 1, table.data(), static_cast<int>(table.size()),
+                    SQLITE_STATIC);
+  sqlite3_bind_text(stmt, 2, checkpointFingerprint.data(),
+                    static_cast<int>(checkpointFingerprint.size()),
+                    SQLITE_STATIC);
+  sqlite3_bind_int64(stmt, 3, static_cast<sqlite3_int64>(totalRows));
+
+  rc = sqlite3_step(stmt);
+  finalizeStatement(stmt);
+
+  if (rc != SQLITE_DONE) {
+    logError("Resetting " + table + " checkpoint");
+    rollbackTransaction();
+    return false;
+  }
+
+  commitTransaction();
+  return true;
+}
+
+bool SQLiteLoaderService::clearCheckpoint(const std::string &table) {
+  sqlite3_stmt *stmt;
+  int rc = sqlite3_prepare_v2(
+      db, "DELETE FROM etl_checkpoints WHERE table_name = ?", -1, &stmt,
+      nullptr);
+  if (rc != SQLITE_OK) {
+    logError("Preparing checkpoint removal");
+    return false;
+  }
+
+  sqlite3_bind_text(stmt, 1, table.data(), static_cast<int>(table.size()),
+                    SQLITE_STATIC);
+
+  rc = sqlite3_step(stmt);
+  finalizeStatement(stmt);
+
+  if (rc != SQLITE_DONE) {
+    logError("Removing " + table + " checkpoint");
+    return false;
+  }
+  return true;
+}
+
+bool SQLiteLoaderService::saveCheckpoint(const std::string &table,
+                                         std::size_t rowsCommitted) {
+  if (checkpointFingerprint.empty()) {
+    return true;
+  }
+
+  sqlite3_stmt *stmt;
+  int rc = sqlite3_prepare_v2(
+      db, "UPDATE etl_checkpoints SET rows_committed = ? WHERE table_name = ?",
+      -1, &stmt, nullptr);
+  if (rc != SQLITE_OK) {
+    logError("Preparing checkpoint update");
+    return false;
+  }
+
+  sqlite3_bind_int64(stmt, 1, static_cast<sqlite3_int64>(rowsCommitted));
+  sqlite3_bind_text(stmt, 2, table.data(), static_cast<int>(table.size()),
+                    SQLITE_STATIC);
+
+  rc = sqlite3_step(stmt);
+  finalizeStatement(stmt);
+
+  if (rc != SQLITE_DONE) {
+    logError("Updating " + table + " checkpoint");
+    return false;
+  }
   return true;
 }
 
+bool SQLiteLoaderService::hasColumns(const std::string &table,
+                                     const std::string &columns) {
+  if (!db)
+    return false;
+
+  // Compiling a query over the columns checks them without reading any rows
+  const std::string sql = "SELECT " + columns + " FROM " + table + " LIMIT 0";
+  sqlite3_stmt *stmt = nullptr;
+  const int rc = sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr);
+  sqlite3_finalize(stmt);
+  return rc == SQLITE_OK;
+}
+
 bool SQLiteLoaderService::tableExists(const std::string &tableName) {
   if (!db)
     return false;
@@ -192,44 +672,75 @@ void SQLiteLoaderService::rollbackTransaction() {
   }
 }
 
-sqlite3_stmt *SQLiteLoaderService::prepareInsertStatement(
-    const std::string &table, const std::vector<std::string> &columns) {
+bool SQLiteLoaderService::RegisterMemoryTables(MemoryTableModule &module) {
+  return db && module.Register(db);
+}
 
+bool SQLiteLoaderService::RunQueries(const std::string &sql) {
   if (!db)
-    return nullptr;
-
-  std::stringstream sql;
-  sql << "INSERT INTO " << table << " (";
+    return false;
 
-  // Add column names
-  for (size_t i = 0; i < columns.size(); ++i) {
-    sql << columns[i];
-    if (i < columns.size() - 1) {
-      sql << ", ";
+  const char *next = sql.c_str();
+  while (*next) {
+    sqlite3_stmt *stmt = nullptr;
+    const char *tail = nullptr;
+    if (sqlite3_prepare_v2(db, next, -1, &stmt, &tail) != SQLITE_OK) {
+      logError("Preparing query");
+      return false;
+    }
+    next = tail;
+    if (!stmt) {
+      continue; // Whitespace or a comment
     }
-  }
 
-  sql << ") VALUES (";
+    const int columns = sqlite3_column_count(stmt);
+    // Echo the statement without the whitespace that preceded it
+    std::string_view text = sqlite3_sql(stmt);
+    text.remove_prefix(std::min(text.find_first_not_of(" \t\r\n"),
+                                text.size()));
+    std::cout << text << "\n";
+    for (int column = 0; column < columns; ++column) {
+      std::cout << (column ? "|" : "") << sqlite3_column_name(stmt, column);
+    }
+    if (columns > 0) {
+      std::cout << "\n";
+    }
 
-  // Add placeholders
-  for (size_t i = 0; i < columns.size(); ++i) {
-    sql << "?";
-    if (i < columns.size() - 1) {
-      sql << ", ";
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+      for (int column = 0; column < columns; ++column) {
+        const auto *text = sqlite3_column_text(stmt, column);
+        std::cout << (column ? "|" : "")
+                  << (text ? reinterpret_cast<const char *>(text) : "");
+      }
+      std::cout << "\n";
+    }
+    if (rc != SQLITE_DONE) {
+      logError("Running query");
+      sqlite3_finalize(stmt);
+      return false;
     }
+    finalizeStatement(stmt);
+    std::cout << std::endl;
   }
+  return true;
+}
 
-  sql << ")";
+bool SQLiteLoaderService::executeStatement(const std::string &sql,
+                                           const std::string &context) {
+  if (!db)
+    return false;
 
-  sqlite3_stmt *stmt;
-  int rc = sqlite3_prepare_v2(db, sql.str().c_str(), -1, &stmt, nullptr);
+  char *errMsg = nullptr;
+  int rc = sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &errMsg);
 
   if (rc != SQLITE_OK) {
-    logError("Preparing insert statement");
-    return nullptr;
+    std::cerr << "Error " << context << ": " << errMsg << std::endl;
+    sqlite3_free(errMsg);
+    return false;
   }
 
-  return stmt;
+  return true;
 }
 
 bool SQLiteLoaderService::finalizeStatement(sqlite3_stmt *stmt) {
@@ -258,82 +769,165 @@ int SQLiteLoaderService::logError(const std::string &context) {
   return errorCode;
 }
 
-bool SQLiteLoaderService::LoadFoods(const std::vector<USDA::Food> &foods) {
-  if (!db || foods.empty()) {
-    return false;
+void SQLiteLoaderService::bindDate(BatchInserter::Row &row,
+                                   const std::chrono::year_month_day &date) const {
+  if (dateFormat == DateFormat::Days) {
+    row.Bind(static_cast<int>(
+        std::chrono::sys_days(date).time_since_epoch().count()));
+    return;
   }
 
-  // Define the columns for the insert statement
-  std::vector<std::string> columns = {"fdc_id", "data_type", "description",
-                                      "food_category_id", "publication_date"};
+  // Formatted into the row's scratch space, which outlives the batch step
+  if (char *buffer = row.Scratch(DATE_BUFFER_SIZE)) {
+    row.BindText(buffer, formatIsoDate(date, buffer, DATE_BUFFER_SIZE));
+    return;
+  }
+  char buffer[DATE_BUFFER_SIZE];
+  row.BindTextCopy(buffer, formatIsoDate(date, buffer, sizeof(buffer)));
+}
+
+void SQLiteLoaderService::bindDate(
+    BatchInserter::Row &row,
+    const std::optional<std::chrono::year_month_day> &date) const {
+  if (date) {
+    bindDate(row, *date);
+  } else {
+    row.BindNull();
+  }
+}
+
+template <typename T, typename BindRow>
+bool SQLiteLoaderService::insertRows(const std::string &table,
+                                     const std::vector<std::string> &columns,
+                                     const std::vector<T> &rows,
+                                     const std::string &label,
+                                     BindRow bindRow) {
+  // Tables finished by an interrupted earlier run are resumed, not redone
+  std::size_t resumeRow = 0;
+  if (!checkpointFingerprint.empty() &&
+      !startCheckpoint(table, rows.size(), resumeRow)) {
+    return false;
+  }
+  if (rows.empty()) {
+    // Nothing to insert; startCheckpoint() has already emptied the table
+    return !checkpointFingerprint.empty() || recreateTable(table);
+  }
+  if (resumeRow == rows.size()) {
+    std::cout << "Skipping " << label << " records: all " << rows.size()
+              << " were loaded by an earlier run" << std::endl;
+    return true;
+  }
+  if (resumeRow > 0) {
+    std::cout << "Resuming " << label << " records at row " << resumeRow
+              << " of " << rows.size() << std::endl;
+  }
 
-  // Prepare the insert statement
-  sqlite3_stmt *stmt = prepareInsertStatement("foods", columns);
-  if (!stmt) {
+  auto excluded = excludedColumns.find(table);
+  BatchInserter inserter(db, table, columns, rows.size() - resumeRow,
+                         excluded != excludedColumns.end()
+                             ? excluded->second
+                             : std::unordered_set<std::string>());
+  if (!inserter.Ok()) {
     return false;
   }
 
-  // Begin transaction for better performance
   beginTransaction();
 
   bool success = true;
-  int count = 0;
-  const int BATCH_SIZE = 10000;
-
-  for (const auto &food : foods) {
-    // Bind parameters to the statement
-    int idx = 1;
-    sqlite3_bind_int(stmt, idx++, food.fdc_id);
-    sqlite3_bind_text(stmt, idx++,
-                      food.data_type == USDA::FoodDataType::Foundation
-                          ? "foundation_food"
-                          : "branded_food",
-                      -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, idx++, food.description.c_str(), -1, SQLITE_STATIC);
-    food.food_category_id
-        ? sqlite3_bind_text(stmt, idx++, food.food_category_id->c_str(), -1,
-                            SQLITE_STATIC)
-        : sqlite3_bind_null(stmt, idx++);
-    std::string dateStr =
-        std::to_string(static_cast<int>(food.publication_date.year())) + "-" +
-        std::to_string(static_cast<unsigned>(food.publication_date.month())) +
-        "-" +
-        std::to_string(static_cast<unsigned>(food.publication_date.day()));
-    sqlite3_bind_text(stmt, idx++, dateStr.c_str(), -1, SQLITE_STATIC);
-
-    // Execute the statement
-    int rc = sqlite3_step(stmt);
-    if (rc != SQLITE_DONE) {
-      logError("Inserting food record");
+  std::size_t count = resumeRow;
+
+  // Transactions are sized from the measured insert rate so that each one
+  // covers about TRANSACTION_SECONDS of work
+  std::size_t transactionRows = 0;
+  std::size_t transactionTarget = INITIAL_TRANSACTION_ROWS;
+  auto transactionStart = std::chrono::steady_clock::now();
+  auto lastProgress = transactionStart;
+
+  for (auto entry = rows.begin() + resumeRow; entry != rows.end(); ++entry) {
+    BatchInserter::Row row = inserter.NextRow();
+    bindRow(row, *entry);
+
+    if (!inserter.EndRow()) {
+      logError("Inserting " + label + " record");
       success = false;
       break;
     }
-
-    // Reset the statement for the next iteration
-    sqlite3_reset(stmt);
-
-    // Commit in batches to avoid excessive memory usage
     count++;
-    if (count % BATCH_SIZE == 0) {
+    transactionRows++;
+
+    // Commit only between statements, once the transaction is big enough
+    if (inserter.PendingRows() == 0 && transactionRows >= transactionTarget) {
+      // The checkpoint is committed atomically with the rows it covers
+      if (!saveCheckpoint(table, count)) {
+        success = false;
+        break;
+      }
       commitTransaction();
+
+      const auto now = std::chrono::steady_clock::now();
+      const double seconds =
+          std::chrono::duration<double>(now - transactionStart).count();
+      if (seconds > 0) {
+        const double rate = static_cast<double>(transactionRows) / seconds;
+        transactionTarget = static_cast<std::size_t>(std::clamp(
+            rate * TRANSACTION_SECONDS,
+            static_cast<double>(MIN_TRANSACTION_ROWS),
+            static_cast<double>(MAX_TRANSACTION_ROWS)));
+      }
+
       beginTransaction();
-      std::cout << "Inserted " << count << " foods of " << foods.size()
-                << " food records..." << std::endl;
+      transactionStart = now;
+      transactionRows = 0;
+
+      if (now - lastProgress >= std::chrono::seconds(1)) {
+        std::cout << "Inserted " << count << " of " << rows.size() << " "
+                  << label << " records...\n";
+        lastProgress = now;
+      }
     }
   }
 
-  // Finalize the statement
-  finalizeStatement(stmt);
+  if (success && !saveCheckpoint(table, count)) {
+    success = false;
+  }
 
   if (success) {
     commitTransaction();
+    std::cout << "Successfully loaded " << count << " " << label << " records"
+              << std::endl;
   } else {
     rollbackTransaction();
+    std::cout << "Failed to load " << label
+              << " records. Rolling back transaction." << std::endl;
   }
 
   return success;
 }
 
+const char *SQLiteLoaderService::dateColumnType() const {
+  return dateFormat == DateFormat::Days ? "INTEGER" : "TEXT";
+}
+
+bool SQLiteLoaderService::LoadFoods(const std::vector<USDA::Food> &foods) {
+  if (!db || foods.empty()) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"fdc_id", "data_type", "description",
+                                      "food_category_id", "publication_date"};
+
+  return insertRows(
+      "foods", columns, foods, "food",
+      [&](BatchInserter::Row &row, const USDA::Food &food) {
+        row.Bind(food.fdc_id);
+        row.Bind(USDA::DataTypeName(food.data_type));
+        row.Bind(food.description);
+        row.Bind(food.food_category_id);
+        bindDate(row, food.publication_date);
+      });
+}
+
 bool SQLiteLoaderService::LoadBrandedFood(
     const std::vector<USDA::BrandedFood> &branded_foods) {
 
@@ -343,251 +937,889 @@ bool SQLiteLoaderService::LoadBrandedFood(
 
   // Define the columns for the insert statement
   std::vector<std::string> columns = {"fdc_id",
-                                      "brand_owner",
+                                      "brand_owner_id",
                                       "brand_name",
                                       "subbrand_name",
                                       "gtin_upc",
                                       "ingredients",
                                       "not_a_significant_source_of",
                                       "serving_size",
-                                      "serving_size_unit",
+                                      "serving_size_unit_id",
                                       "household_serving_fulltext",
-                                      "branded_food_category",
-                                      "data_source",
+                                      "branded_food_category_id",
+                                      "data_source_id",
                                       "package_weight",
                                       "modified_date",
                                       "available_date",
                                       "discontinued_date",
-                                      "market_country",
+                                      "market_country_id",
                                       "preparation_state_code",
                                       "trade_channel",
                                       "short_description",
                                       "material_code"};
 
-  // Prepare the insert statement
-  sqlite3_stmt *stmt = prepareInsertStatement("branded_foods", columns);
-  if (!stmt) {
-    return false;
+  return insertRows(
+      "branded_foods", columns, branded_foods, "branded food",
+      [&](BatchInserter::Row &row, const USDA::BrandedFood &food) {
+        row.Bind(food.fdc_id);
+        bindKey(row, food.brand_owner_id);
+        row.Bind(food.brand_name);
+        row.Bind(food.subbrand_name);
+        row.Bind(food.gtin_upc);
+        row.Bind(food.ingredients);
+        row.Bind(food.not_a_significant_source_of);
+        row.Bind(food.serving_size);
+        bindKey(row, food.serving_size_unit_id);
+        row.Bind(food.household_serving_fulltext);
+        bindKey(row, food.branded_food_category_id);
+        bindKey(row, food.data_source_id);
+        row.Bind(food.package_weight);
+
+        bindDate(row, food.modified_date);
+        bindDate(row, food.available_date);
+        bindDate(row, food.discontinued_date);
+
+        bindKey(row, food.market_country_id);
+        row.Bind(food.preparation_state_code);
+        row.Bind(food.trade_channel);
+        row.Bind(food.short_description);
+        row.Bind(food.material_code);
+      });
+}
+
+bool SQLiteLoaderService::LoadFoodCategory(
+    const std::vector<USDA::FoodCategory> &food_categories) {
+  if (!db || food_categories.empty()) {
+    return false;
   }
 
-  // Begin transaction for better performance
-  beginTransaction();
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"id", "code", "description"};
+
+  return insertRows(
+      "food_categories", columns, food_categories, "food category",
+      [](BatchInserter::Row &row, const USDA::FoodCategory &food_category) {
+        row.Bind(food_category.id);
+        row.Bind(food_category.code);
+        row.Bind(food_category.description);
+      });
+}
+
+bool SQLiteLoaderService::LoadNutrients(
+    const std::vector<USDA::Nutrient> &nutrients) {
+  if (!db || nutrients.empty()) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"id", "name", "unit_name",
+                                      "nutrient_nbr", "rank"};
+
+  return insertRows(
+      "nutrients", columns, nutrients, "nutrient",
+      [](BatchInserter::Row &row, const USDA::Nutrient &nutrient) {
+        row.Bind(nutrient.id);
+        row.Bind(nutrient.name);
+        // Normalized units are written with their canonical symbol
+        if (nutrient.unit != USDA::Unit::Unknown) {
+          row.Bind(USDA::UnitSymbol(nutrient.unit));
+        } else {
+          row.Bind(nutrient.unit_name);
+        }
+        row.Bind(nutrient.nutrient_nbr);
+        row.Bind(nutrient.rank);
+      });
+}
+
+bool SQLiteLoaderService::LoadMeasureUnits(
+    const std::vector<USDA::MeasureUnit> &measure_units) {
+  if (!db || measure_units.empty()) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"id", "name", "unit"};
+
+  return insertRows(
+      "measure_units", columns, measure_units, "measure unit",
+      [](BatchInserter::Row &row, const USDA::MeasureUnit &measure_unit) {
+        row.Bind(measure_unit.id);
+        row.Bind(measure_unit.name);
+        row.Bind(measure_unit.unit != USDA::Unit::Unknown
+                     ? USDA::UnitSymbol(measure_unit.unit)
+                     : nullptr);
+      });
+}
+
+bool SQLiteLoaderService::LoadFoodNutrients(
+    const std::vector<USDA::FoodNutrient> &food_nutrients) {
+  if (!db || food_nutrients.empty()) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"id",
+                                      "fdc_id",
+                                      "nutrient_id",
+                                      "amount",
+                                      "amount_per_serving",
+                                      "data_points",
+                                      "derivation_id",
+                                      "min",
+                                      "max",
+                                      "median",
+                                      "loq",
+                                      "footnote",
+                                      "min_year_acquired",
+                                      "percent_daily_value"};
+
+  return insertRows(
+      "food_nutrients", columns, food_nutrients, "food nutrient",
+      [](BatchInserter::Row &row, const USDA::FoodNutrient &food_nutrient) {
+        row.Bind(food_nutrient.id);
+        row.Bind(food_nutrient.fdc_id);
+        row.Bind(food_nutrient.nutrient_id);
+        row.Bind(food_nutrient.amount);
+        row.Bind(food_nutrient.amount_per_serving);
+        row.Bind(food_nutrient.data_points);
+        row.Bind(food_nutrient.derivation_id);
+        row.Bind(food_nutrient.min);
+        row.Bind(food_nutrient.max);
+        row.Bind(food_nutrient.median);
+        row.Bind(food_nutrient.loq);
+        row.Bind(food_nutrient.footnote);
+        row.Bind(food_nutrient.min_year_acquired);
+        row.Bind(food_nutrient.percent_daily_value);
+      });
+}
+
+bool SQLiteLoaderService::LoadFoodPortions(
+    const std::vector<USDA::FoodPortion> &food_portions) {
+  if (!db || food_portions.empty()) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"id",
+                                      "fdc_id",
+                                      "seq_num",
+                                      "amount",
+                                      "measure_unit_id",
+                                      "portion_description",
+                                      "modifier",
+                                      "gram_weight",
+                                      "data_points",
+                                      "footnote",
+                                      "min_year_acquired"};
+
+  return insertRows(
+      "food_portions", columns, food_portions, "food portion",
+      [](BatchInserter::Row &row, const USDA::FoodPortion &food_portion) {
+        row.Bind(food_portion.id);
+        row.Bind(food_portion.fdc_id);
+        row.Bind(food_portion.seq_num);
+        row.Bind(food_portion.amount);
+        row.Bind(food_portion.measure_unit_id);
+        row.Bind(food_portion.portion_description);
+        row.Bind(food_portion.modifier);
+        row.Bind(food_portion.gram_weight);
+        row.Bind(food_portion.data_points);
+        row.Bind(food_portion.footnote);
+        row.Bind(food_portion.min_year_acquired);
+      });
+}
+
+bool SQLiteLoaderService::LoadFoodAttributes(
+    const std::vector<USDA::FoodAttribute> &food_attributes) {
+  // Only some releases ship food attributes; an empty input still replaces
+  // rows left by an earlier load
+  if (!db) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {
+      "id", "fdc_id", "seq_num", "food_attribute_type_id", "name", "value"};
+
+  return insertRows(
+      "food_attributes", columns, food_attributes, "food attribute",
+      [](BatchInserter::Row &row, const USDA::FoodAttribute &attribute) {
+        row.Bind(attribute.id);
+        row.Bind(attribute.fdc_id);
+        row.Bind(attribute.seq_num);
+        row.Bind(attribute.food_attribute_type_id);
+        row.Bind(attribute.name);
+        row.Bind(attribute.value);
+      });
+}
+
+bool SQLiteLoaderService::LoadInputFoods(
+    const std::vector<USDA::InputFood> &input_foods) {
+  // Only some releases ship input foods; an empty input still replaces rows
+  // left by an earlier load
+  if (!db) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"id",
+                                      "fdc_id",
+                                      "fdc_id_of_input_food",
+                                      "seq_num",
+                                      "amount",
+                                      "sr_code",
+                                      "sr_description",
+                                      "unit",
+                                      "portion_code",
+                                      "portion_description",
+                                      "gram_weight",
+                                      "retention_code"};
+
+  return insertRows(
+      "input_foods", columns, input_foods, "input food",
+      [](BatchInserter::Row &row, const USDA::InputFood &input_food) {
+        row.Bind(input_food.id);
+        row.Bind(input_food.fdc_id);
+        row.Bind(input_food.fdc_id_of_input_food);
+        row.Bind(input_food.seq_num);
+        row.Bind(input_food.amount);
+        row.Bind(input_food.sr_code);
+        row.Bind(input_food.sr_description);
+        row.Bind(input_food.unit);
+        row.Bind(input_food.portion_code);
+        row.Bind(input_food.portion_description);
+        row.Bind(input_food.gram_weight);
+        row.Bind(input_food.retention_code);
+      });
+}
+
+bool SQLiteLoaderService::LoadSurveyFnddsFoods(
+    const std::vector<USDA::SurveyFnddsFood> &survey_fndds_foods) {
+  // Only the Survey (FNDDS) release ships these rows; an empty input still
+  // replaces rows left by an earlier load
+  if (!db) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"fdc_id", "food_code",
+                                      "wweia_category_code", "start_date",
+                                      "end_date"};
+
+  return insertRows(
+      "survey_fndds_foods", columns, survey_fndds_foods, "survey FNDDS food",
+      [&](BatchInserter::Row &row, const USDA::SurveyFnddsFood &survey_food) {
+        row.Bind(survey_food.fdc_id);
+        row.Bind(survey_food.food_code);
+        row.Bind(survey_food.wweia_category_code);
+        bindDate(row, survey_food.start_date);
+        bindDate(row, survey_food.end_date);
+      });
+}
+
+bool SQLiteLoaderService::LoadGtinIndex(
+    const std::vector<USDA::GtinIndexEntry> &gtin_index_entries) {
+  // Releases without valid barcodes have no entries; an empty input still
+  // replaces rows left by an earlier load
+  if (!db) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"gtin", "fdc_id"};
+
+  // Entries arrive sorted by primary key, so every insert appends to the
+  // rightmost B-tree page
+  return insertRows(
+      "gtin_index", columns, gtin_index_entries, "GTIN index",
+      [](BatchInserter::Row &row, const USDA::GtinIndexEntry &entry) {
+        row.Bind(static_cast<sqlite3_int64>(entry.gtin));
+        row.Bind(entry.fdc_id);
+      });
+}
+
+bool SQLiteLoaderService::LoadIngredients(
+    const std::vector<USDA::Ingredient> &ingredients) {
+  // Branded foods without parseable ingredients leave no entries; an empty
+  // input still replaces rows left by an earlier load
+  if (!db) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"id", "name"};
+
+  return insertRows(
+      "ingredients", columns, ingredients, "ingredient",
+      [](BatchInserter::Row &row, const USDA::Ingredient &ingredient) {
+        row.Bind(ingredient.id);
+        row.Bind(ingredient.name);
+      });
+}
+
+bool SQLiteLoaderService::LoadDimension(
+    const std::string &column,
+    const std::vector<USDA::DimensionValue> &values) {
+  if (!db) {
+    return false;
+  }
+
+  for (const DimensionTable &dimension : DIMENSION_TABLES) {
+    if (column != dimension.column) {
+      continue;
+    }
+    // A column without any values still gets its (empty) table
+    std::vector<std::string> columns = {"id", "name"};
+    return insertRows(
+        dimension.table, columns, values, dimension.label,
+        [](BatchInserter::Row &row, const USDA::DimensionValue &value) {
+          row.Bind(value.id);
+          row.Bind(value.name);
+        });
+  }
+
+  std::cerr << "No lookup table for branded_foods." << column << std::endl;
+  return false;
+}
+
+bool SQLiteLoaderService::LoadBrandedFoodIngredients(
+    const std::vector<USDA::BrandedFoodIngredient> &branded_food_ingredients) {
+  // Empty along with the ingredient dictionary, see LoadIngredients()
+  if (!db) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"fdc_id", "ingredient_id", "position"};
+
+  return insertRows(
+      "branded_food_ingredients", columns, branded_food_ingredients,
+      "branded food ingredient",
+      [](BatchInserter::Row &row, const USDA::BrandedFoodIngredient &link) {
+        row.Bind(link.fdc_id);
+        row.Bind(link.ingredient_id);
+        row.Bind(link.position);
+      });
+}
+
+bool SQLiteLoaderService::LoadNutrientCategoryStats(
+    const std::vector<USDA::NutrientCategoryStat> &nutrient_category_stats) {
+  // A release without categorized amounts yields no rows; the empty table
+  // still replaces rows left by an earlier load
+  if (!db) {
+    return false;
+  }
+
+  // Define the columns for the insert statement
+  std::vector<std::string> columns = {"category_type", "category",
+                                      "nutrient_id",   "food_count",
+                                      "mean",          "p10",
+                                      "median",        "p90"};
+
+  // Entries arrive sorted by primary key
+  return insertRows(
+      "nutrient_category_stats", columns, nutrient_category_stats,
+      "nutrient category stat",
+      [](BatchInserter::Row &row, const USDA::NutrientCategoryStat &stat) {
+        row.Bind(stat.category_type);
+        row.Bind(stat.category);
+        row.Bind(stat.nutrient_id);
+        row.Bind(stat.food_count);
+        row.Bind(stat.mean);
+        row.Bind(stat.p10);
+        row.Bind(stat.median);
+        row.Bind(stat.p90);
+      });
+}
+
+bool SQLiteLoaderService::BuildIndexes() {
+  if (!db) {
+    return false;
+  }
+
+  // Index builds are dominated by sorting: let SQLite's sorter use helper
+  // threads, and give it a large page cache so runs are merged in memory
+  const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  const std::string tuneSql =
+      "PRAGMA threads = " + std::to_string(threads) +
+      "; PRAGMA cache_size = -" + std::to_string(INDEX_CACHE_KIB);
+  if (!executeStatement(tuneSql, "configuring index build")) {
+    return false;
+  }
 
   bool success = true;
-  int count = 0;
-  const int BATCH_SIZE = 10000;
-
-  for (const auto &food : branded_foods) {
-    // Bind parameters to the statement
-    int idx = 1;
-    sqlite3_bind_int(stmt, idx++, food.fdc_id);
-    food.brand_owner ? sqlite3_bind_text(stmt, idx++, food.brand_owner->c_str(),
-                                         -1, SQLITE_TRANSIENT)
-                     : sqlite3_bind_null(stmt, idx++);
-    food.brand_name ? sqlite3_bind_text(stmt, idx++, food.brand_name->c_str(),
-                                        -1, SQLITE_TRANSIENT)
-                    : sqlite3_bind_null(stmt, idx++);
-    food.subbrand_name
-        ? sqlite3_bind_text(stmt, idx++, food.subbrand_name->c_str(), -1,
-                            SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-    food.gtin_upc ? sqlite3_bind_text(stmt, idx++, food.gtin_upc->c_str(), -1,
-                                      SQLITE_TRANSIENT)
-                  : sqlite3_bind_null(stmt, idx++);
-    food.ingredients ? sqlite3_bind_text(stmt, idx++, food.ingredients->c_str(),
-                                         -1, SQLITE_TRANSIENT)
-                     : sqlite3_bind_null(stmt, idx++);
-    food.not_a_significant_source_of
-        ? sqlite3_bind_text(stmt, idx++,
-                            food.not_a_significant_source_of->c_str(), -1,
-                            SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-
-    // Handle optional numeric fields
-    if (food.serving_size) {
-      sqlite3_bind_double(stmt, idx++, *food.serving_size);
-    } else {
-      sqlite3_bind_null(stmt, idx++);
-    }
-
-    food.serving_size_unit
-        ? sqlite3_bind_text(stmt, idx++, food.serving_size_unit->c_str(), -1,
-                            SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-    food.household_serving_fulltext
-        ? sqlite3_bind_text(stmt, idx++,
-                            food.household_serving_fulltext->c_str(), -1,
-                            SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-    food.branded_food_category
-        ? sqlite3_bind_text(stmt, idx++, food.branded_food_category->c_str(),
-                            -1, SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-    food.data_source ? sqlite3_bind_text(stmt, idx++, food.data_source->c_str(),
-                                         -1, SQLITE_TRANSIENT)
-                     : sqlite3_bind_null(stmt, idx++);
-    food.package_weight
-        ? sqlite3_bind_text(stmt, idx++, food.package_weight->c_str(), -1,
-                            SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-
-    // Handle date fields by converting year_month_day to string
-    if (food.modified_date) {
-      std::string dateStr =
-          std::to_string(static_cast<int>(food.modified_date->year())) + "-" +
-          std::to_string(static_cast<unsigned>(food.modified_date->month())) +
-          "-" +
-          std::to_string(static_cast<unsigned>(food.modified_date->day()));
-      sqlite3_bind_text(stmt, idx++, dateStr.c_str(), -1, SQLITE_TRANSIENT);
-    } else {
-      sqlite3_bind_null(stmt, idx++);
-    }
-
-    if (food.available_date) {
-      std::string dateStr =
-          std::to_string(static_cast<int>(food.available_date->year())) + "-" +
-          std::to_string(static_cast<unsigned>(food.available_date->month())) +
-          "-" +
-          std::to_string(static_cast<unsigned>(food.available_date->day()));
-      sqlite3_bind_text(stmt, idx++, dateStr.c_str(), -1, SQLITE_TRANSIENT);
-    } else {
-      sqlite3_bind_null(stmt, idx++);
-    }
-
-    if (food.discontinued_date) {
-      std::string dateStr =
-          std::to_string(static_cast<int>(food.discontinued_date->year())) +
-          "-" +
-          std::to_string(
-              static_cast<unsigned>(food.discontinued_date->month())) +
-          "-" +
-          std::to_string(static_cast<unsigned>(food.discontinued_date->day()));
-      sqlite3_bind_text(stmt, idx++, dateStr.c_str(), -1, SQLITE_TRANSIENT);
-    } else {
-      sqlite3_bind_null(stmt, idx++);
-    }
-
-    food.market_country
-        ? sqlite3_bind_text(stmt, idx++, food.market_country->c_str(), -1,
-                            SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-    food.preparation_state_code
-        ? sqlite3_bind_text(stmt, idx++, food.preparation_state_code->c_str(),
-                            -1, SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-    food.trade_channel
-        ? sqlite3_bind_text(stmt, idx++, food.trade_channel->c_str(), -1,
-                            SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-    food.short_description
-        ? sqlite3_bind_text(stmt, idx++, food.short_description->c_str(), -1,
-                            SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-    food.material_code
-        ? sqlite3_bind_text(stmt, idx++, food.material_code->c_str(), -1,
-                            SQLITE_TRANSIENT)
-        : sqlite3_bind_null(stmt, idx++);
-
-    // Execute the statement
-    int rc = sqlite3_step(stmt);
-    if (rc != SQLITE_DONE) {
-      logError("Inserting branded food record");
+
+  for (const SecondaryIndex &index : SECONDARY_INDEXES) {
+    // Tables and columns left out of the profile have nothing to index
+    if (!hasColumns(index.table, index.columns)) {
+      continue;
+    }
+
+    // Covering columns are only added while every one of them is loaded
+    std::string columns = index.columns;
+    if (outputProfile == OutputProfile::Compact && index.covering &&
+        hasColumns(index.table, columns + ", " + index.covering)) {
+      columns = columns + ", " + index.covering;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    const std::string sql = std::string("CREATE INDEX IF NOT EXISTS ") +
+                            index.name + " ON " + index.table + " (" +
+                            columns + ")";
+    if (!executeStatement(sql, std::string("creating index ") + index.name)) {
       success = false;
-      break;
+      continue;
     }
 
-    // Reset the statement for the next record
-    sqlite3_reset(stmt);
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << "Built index " << index.name << " in " << elapsed.count()
+              << " ms" << std::endl;
+  }
 
-    // Commit in batches to avoid excessive memory usage
-    count++;
-    if (count % BATCH_SIZE == 0) {
-      commitTransaction();
-      beginTransaction();
-      std::cout << "Inserted " << count << " of " << branded_foods.size()
-                << " branded food records..." << std::endl;
+  // Collect statistics so the query planner can choose between the indexes
+  if (!executeStatement("ANALYZE", "analyzing tables")) {
+    success = false;
+  }
+
+  return success;
+}
+
+bool SQLiteLoaderService::Finalize(bool vacuum) {
+  if (!db) {
+    return false;
+  }
+
+  // The build is published as is, so it must not ship its load progress
+  // either (see CompactInto()); dropping it first lets VACUUM reclaim it
+  if (!executeStatement("DROP TABLE IF EXISTS etl_checkpoints",
+                        "dropping load checkpoints")) {
+    return false;
+  }
+
+  if (vacuum) {
+    const auto start = std::chrono::steady_clock::now();
+    if (!executeStatement("VACUUM", "vacuuming database")) {
+      return false;
     }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << "Vacuumed database in " << elapsed.count() << " ms"
+              << std::endl;
   }
 
-  // Finalize the statement
-  finalizeStatement(stmt);
+  // The pragma returns the mode now in effect, which stays the old one if
+  // the switch is not possible
+  sqlite3_stmt *stmt;
+  if (sqlite3_prepare_v2(db, "PRAGMA journal_mode = WAL", -1, &stmt,
+                         nullptr) != SQLITE_OK) {
+    logError("Preparing journal mode switch");
+    return false;
+  }
+  bool wal = false;
+  if (sqlite3_step(stmt) == SQLITE_ROW) {
+    const auto *mode =
+        reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0));
+    wal = mode && std::string_view(mode) == "wal";
+  }
+  sqlite3_finalize(stmt);
 
-  // Commit or rollback the transaction based on success
-  if (success) {
-    commitTransaction();
-    std::cout << "Successfully loaded " << count << " branded food records"
+  if (!wal) {
+    std::cerr << "Could not switch the database to WAL mode" << std::endl;
+  }
+  return wal;
+}
+
+bool SQLiteLoaderService::Publish(const std::string &buildPath,
+                                  const std::string &dbPath) {
+  namespace fs = std::filesystem;
+  std::error_code error;
+
+  for (const char *suffix : {"-journal", "-wal"}) {
+    if (fs::exists(buildPath + suffix, error)) {
+      std::cerr << "Not publishing " << buildPath << ": " << buildPath
+                << suffix << " is still present" << std::endl;
+      return false;
+    }
+  }
+  // Only the last connection's shared-memory index can be left behind
+  fs::remove(buildPath + "-shm", error);
+
+  const auto walSize = fs::file_size(dbPath + "-wal", error);
+  const bool pendingWal = !error && walSize > 0;
+  if (pendingWal || fs::exists(dbPath + "-journal", error)) {
+    std::cerr << "Not publishing " << buildPath << ": " << dbPath
+              << " has uncommitted changes in its journal or WAL"
               << std::endl;
+    return false;
+  }
+
+  fs::rename(buildPath, dbPath, error);
+  if (error) {
+    std::cerr << "Failed to publish " << buildPath << " as " << dbPath
+              << ": " << error.message() << std::endl;
+    return false;
+  }
+
+  fs::path directory = fs::path(dbPath).parent_path();
+  if (directory.empty()) {
+    directory = ".";
+  }
+  const int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+  if (fd >= 0) {
+    ::fsync(fd);
+    ::close(fd);
+  }
+  return true;
+}
+
+bool SQLiteLoaderService::CompactInto(const std::string &path) {
+  if (!db) {
+    return false;
+  }
+
+  // VACUUM INTO only writes to a missing or empty file
+  std::error_code error;
+  std::filesystem::remove(path, error);
+
+  // The checkpoints describe the build's inputs, not the shipped data
+  if (!executeStatement("DROP TABLE IF EXISTS etl_checkpoints",
+                        "dropping load checkpoints") ||
+      !executeStatement("PRAGMA page_size = " +
+                            std::to_string(COMPACT_PAGE_SIZE),
+                        "setting compact page size")) {
+    return false;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+
+  sqlite3_stmt *stmt;
+  if (sqlite3_prepare_v2(db, "VACUUM INTO ?", -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    logError("Preparing compact copy");
+    return false;
+  }
+  sqlite3_bind_text(stmt, 1, path.c_str(), -1, SQLITE_STATIC);
+  if (sqlite3_step(stmt) != SQLITE_DONE) {
+    logError("Writing compact copy");
+    sqlite3_finalize(stmt);
+    return false;
+  }
+  sqlite3_finalize(stmt);
+
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  std::cout << "Wrote compact copy " << path << " in " << elapsed.count()
+            << " ms" << std::endl;
+  return true;
+}
+
+bool SQLiteLoaderService::WriteBuildReport(const std::string &path) {
+  if (!db) {
+    return false;
+  }
+
+  // Runs a query and hands every row to a callback
+  auto forEachRow = [this](const char *sql, const std::string &context,
+                           auto &&onRow) {
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+      logError(context);
+      return false;
+    }
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+      onRow(stmt);
+    }
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_DONE) {
+      logError(context);
+      return false;
+    }
+    return true;
+  };
+  auto text = [](sqlite3_stmt *stmt, int column) {
+    const auto *value = sqlite3_column_text(stmt, column);
+    return std::string(value ? reinterpret_cast<const char *>(value) : "");
+  };
+
+  struct ObjectSize {
+    std::string type;
+    std::string name;
+    std::string table;
+    bool has_rows;
+    sqlite3_int64 rows = 0;
+    sqlite3_int64 pages = 0;
+    sqlite3_int64 bytes = 0;
+    sqlite3_int64 payload = 0;
+    sqlite3_int64 unused = 0;
+  };
+  std::vector<ObjectSize> objects;
+
+  sqlite3_int64 page_size = 0;
+  sqlite3_int64 page_count = 0;
+  if (!forEachRow("SELECT page_size, page_count FROM pragma_page_size, "
+                  "pragma_page_count",
+                  "Reading page counts",
+                  [&](sqlite3_stmt *stmt) {
+                    page_size = sqlite3_column_int64(stmt, 0);
+                    page_count = sqlite3_column_int64(stmt, 1);
+                  }) ||
+      !forEachRow("SELECT type, name, tbl_name, rootpage FROM sqlite_schema "
+                  "WHERE type IN ('table', 'index') "
+                  "ORDER BY tbl_name, type DESC, name",
+                  "Listing tables and indexes", [&](sqlite3_stmt *stmt) {
+                    // Virtual tables (rootpage 0) store their rows elsewhere
+                    objects.push_back({text(stmt, 0), text(stmt, 1),
+                                       text(stmt, 2),
+                                       text(stmt, 0) == "table" &&
+                                           sqlite3_column_int64(stmt, 3) > 0});
+                  })) {
+    return false;
+  }
+
+  for (ObjectSize &object : objects) {
+    if (!object.has_rows) {
+      continue;
+    }
+    const std::string sql = "SELECT count(*) FROM \"" + object.name + "\"";
+    if (!forEachRow(sql.c_str(), "Counting rows of " + object.name,
+                    [&](sqlite3_stmt *stmt) {
+                      object.rows = sqlite3_column_int64(stmt, 0);
+                    })) {
+      return false;
+    }
+  }
+
+  // dbstat is an optional part of SQLite; without it only rows are known
+  sqlite3_stmt *probe = nullptr;
+  const bool has_sizes =
+      sqlite3_prepare_v2(db, "SELECT 1 FROM dbstat LIMIT 0", -1, &probe,
+                         nullptr) == SQLITE_OK;
+  sqlite3_finalize(probe);
+  if (has_sizes &&
+      !forEachRow("SELECT name, count(*), sum(pgsize), sum(payload), "
+                  "sum(unused) FROM dbstat GROUP BY name",
+                  "Measuring tables and indexes", [&](sqlite3_stmt *stmt) {
+                    const std::string name = text(stmt, 0);
+                    for (ObjectSize &object : objects) {
+                      if (object.name == name) {
+                        object.pages = sqlite3_column_int64(stmt, 1);
+                        object.bytes = sqlite3_column_int64(stmt, 2);
+                        object.payload = sqlite3_column_int64(stmt, 3);
+                        object.unused = sqlite3_column_int64(stmt, 4);
+                      }
+                    }
+                  })) {
+    return false;
+  }
+
+  std::ofstream file(path, std::ios::out | std::ios::trunc);
+  if (!file) {
+    std::cerr << "Failed to open build report file: " << path << "\n";
+    return false;
+  }
+
+  file << "{\n  \"output_profile\": \""
+       << (outputProfile == OutputProfile::Compact ? "compact" : "standard")
+       << "\",\n  \"page_size\": " << page_size
+       << ",\n  \"pages\": " << page_count
+       << ",\n  \"bytes\": " << page_size * page_count
+       << ",\n  \"objects\": [";
+  for (std::size_t i = 0; i < objects.size(); ++i) {
+    const ObjectSize &object = objects[i];
+    file << (i > 0 ? ",\n" : "\n") << "    {\"name\": \"" << object.name
+         << "\", \"type\": \"" << object.type << "\", \"table\": \""
+         << object.table << "\"";
+    if (object.has_rows) {
+      file << ", \"rows\": " << object.rows;
+    }
+    if (has_sizes) {
+      file << ", \"pages\": " << object.pages << ", \"bytes\": "
+           << object.bytes << ", \"payload_bytes\": " << object.payload
+           << ", \"unused_bytes\": " << object.unused;
+    }
+    file << "}";
+  }
+  file << "\n  ]\n}\n";
+
+  file.flush();
+  if (!file) {
+    std::cerr << "Failed to write build report file: " << path << "\n";
+    return false;
+  }
+  return true;
+}
+
+bool SQLiteLoaderService::BuildFullTextIndex() {
+  if (!db) {
+    return false;
+  }
+
+  bool built_foods =
+      buildFullTextTable("foods_fts", "foods", "fdc_id", {"description"});
+  // Only searchable when the profile keeps the indexed branded columns
+  bool built_branded_foods = true;
+  if (hasColumns("branded_foods", "brand_name, ingredients")) {
+    built_branded_foods =
+        buildFullTextTable("branded_foods_fts", "branded_foods", "fdc_id",
+                           {"brand_name", "ingredients"});
   } else {
-    rollbackTransaction();
-    std::cout << "Failed to load branded foods. Rolling back transaction."
+    std::cout << "Skipping branded_foods_fts: brand_name or ingredients is "
+                 "not loaded"
               << std::endl;
   }
 
-  return success;
+  return built_foods && built_branded_foods;
 }
 
-bool SQLiteLoaderService::LoadFoodCategory(
-    const std::vector<USDA::FoodCategory> &food_categories) {
-  if (!db || food_categories.empty()) {
+bool SQLiteLoaderService::buildFullTextTable(
+    const std::string &ftsTable, const std::string &contentTable,
+    const std::string &rowidColumn, const std::vector<std::string> &columns) {
+
+  std::stringstream columnList;
+  for (size_t i = 0; i < columns.size(); ++i) {
+    columnList << columns[i];
+    if (i < columns.size() - 1) {
+      columnList << ", ";
+    }
+  }
+
+  // Always rebuild from scratch so the index matches the freshly loaded rows
+  if (!executeStatement("DROP TABLE IF EXISTS " + ftsTable,
+                        "dropping " + ftsTable + " table")) {
     return false;
   }
 
-  // Define the columns for the insert statement
-  std::vector<std::string> columns = {"id", "code", "description"};
+  // External-content mode: the FTS table only stores the inverted index and
+  // reads the original text back from the content table when needed
+  std::stringstream createSql;
+  createSql << "CREATE VIRTUAL TABLE " << ftsTable << " USING fts5("
+            << columnList.str() << ", content='" << contentTable
+            << "', content_rowid='" << rowidColumn
+            << "', tokenize='unicode61 remove_diacritics 2')";
 
-  // Prepare the insert statement
-  sqlite3_stmt *stmt = prepareInsertStatement("food_categories", columns);
+  if (!executeStatement(createSql.str(), "creating " + ftsTable + " table")) {
+    return false;
+  }
 
-  if (!stmt) {
+  // Bulk build tuning: no incremental merging while inserting, a large
+  // in-memory term buffer so each batch flushes as a few big segments, and
+  // a high crisis-merge threshold so segments are merged once at the end
+  std::stringstream tuneSql;
+  tuneSql << "INSERT INTO " << ftsTable << "(" << ftsTable
+          << ", rank) VALUES('automerge', 0);"
+          << "INSERT INTO " << ftsTable << "(" << ftsTable
+          << ", rank) VALUES('crisismerge', 64);"
+          << "INSERT INTO " << ftsTable << "(" << ftsTable
+          << ", rank) VALUES('hashsize', 67108864);";
+
+  if (!executeStatement(tuneSql.str(), "configuring " + ftsTable + " table")) {
     return false;
   }
 
-  beginTransaction();
+  // Populate in key ranges so each transaction indexes a large batch
+  std::stringstream insertSql;
+  insertSql << "INSERT INTO " << ftsTable << "(rowid, " << columnList.str()
+            << ") SELECT " << rowidColumn << ", " << columnList.str()
+            << " FROM " << contentTable << " WHERE " << rowidColumn
+            << " > ? ORDER BY " << rowidColumn << " LIMIT ?";
+
+  sqlite3_stmt *insertStmt;
+  int rc = sqlite3_prepare_v2(db, insertSql.str().c_str(), -1, &insertStmt,
+                              nullptr);
+  if (rc != SQLITE_OK) {
+    logError("Preparing full-text insert statement");
+    return false;
+  }
+
+  std::stringstream boundarySql;
+  boundarySql << "SELECT max(" << rowidColumn << ") FROM (SELECT "
+              << rowidColumn << " FROM " << contentTable << " WHERE "
+              << rowidColumn << " > ? ORDER BY " << rowidColumn
+              << " LIMIT ?)";
+
+  sqlite3_stmt *boundaryStmt;
+  rc = sqlite3_prepare_v2(db, boundarySql.str().c_str(), -1, &boundaryStmt,
+                          nullptr);
+  if (rc != SQLITE_OK) {
+    logError("Preparing full-text batch boundary statement");
+    finalizeStatement(insertStmt);
+    return false;
+  }
 
   bool success = true;
-  int count = 0;
-  const int BATCH_SIZE = 10000;
-
-  for (const auto &food_category : food_categories) {
-    int idx = 1;
-    sqlite3_bind_int(stmt, idx++, food_category.id);
-    sqlite3_bind_int(stmt, idx++, food_category.code);
-    sqlite3_bind_text(stmt, idx++, food_category.description.c_str(), -1,
-                      SQLITE_STATIC);
-
-    // Execute the statement
-    int rc = sqlite3_step(stmt);
-    if (rc != SQLITE_DONE) {
-      logError("Inserting food category record");
+  sqlite3_int64 lastRowid = -1;
+  long long count = 0;
+  const int BATCH_SIZE = 250000;
+
+  while (success) {
+    // Find the last key of the next batch; NULL means nothing is left
+    sqlite3_bind_int64(boundaryStmt, 1, lastRowid);
+    sqlite3_bind_int(boundaryStmt, 2, BATCH_SIZE);
+    rc = sqlite3_step(boundaryStmt);
+    if (rc != SQLITE_ROW) {
+      logError("Finding full-text batch boundary");
       success = false;
       break;
     }
+    const bool done = sqlite3_column_type(boundaryStmt, 0) == SQLITE_NULL;
+    const sqlite3_int64 batchEnd = sqlite3_column_int64(boundaryStmt, 0);
+    sqlite3_reset(boundaryStmt);
 
-    // Reset the statement for the next record
-    sqlite3_reset(stmt);
+    if (done) {
+      break;
+    }
 
-    // Commit in batches to avoid excessive memory usage
-    count++;
-    if (count % BATCH_SIZE == 0) {
-      commitTransaction();
-      beginTransaction();
-      std::cout << "Inserted " << count << " of " << food_categories.size()
-                << " food category records..." << std::endl;
+    beginTransaction();
+
+    sqlite3_bind_int64(insertStmt, 1, lastRowid);
+    sqlite3_bind_int(insertStmt, 2, BATCH_SIZE);
+    rc = sqlite3_step(insertStmt);
+    if (rc != SQLITE_DONE) {
+      logError("Populating " + ftsTable);
+      success = false;
+      break;
     }
+    count += sqlite3_changes(db);
+    sqlite3_reset(insertStmt);
+
+    commitTransaction();
+    lastRowid = batchEnd;
+
+    std::cout << "Indexed " << count << " " << contentTable
+              << " records for full-text search...\n";
   }
 
-  // Finalize the statement
-  finalizeStatement(stmt);
+  finalizeStatement(boundaryStmt);
+  finalizeStatement(insertStmt);
 
-  if (success) {
-    commitTransaction();
-    std::cout << "Successfully loaded " << count << " food category records"
-              << std::endl;
-  } else {
+  if (!success) {
     rollbackTransaction();
-    std::cout << "Failed to load food categories. Rolling back transaction."
-              << std::endl;
+    std::cout << "Failed to build " << ftsTable << "." << std::endl;
+    return false;
   }
 
-  return success;
+  // Merge all segments into one b-tree for the fastest queries
+  std::stringstream optimizeSql;
+  optimizeSql << "INSERT INTO " << ftsTable << "(" << ftsTable
+              << ") VALUES('optimize')";
+  if (!executeStatement(optimizeSql.str(), "optimizing " + ftsTable)) {
+    return false;
+  }
+
+  // Restore the default merge behaviour for later incremental updates
+  std::stringstream restoreSql;
+  restoreSql << "INSERT INTO " << ftsTable << "(" << ftsTable
+             << ", rank) VALUES('automerge', 4);"
+             << "INSERT INTO " << ftsTable << "(" << ftsTable
+             << ", rank) VALUES('crisismerge', 16)";
+  if (!executeStatement(restoreSql.str(), "configuring " + ftsTable)) {
+    return false;
+  }
+
+  std::cout << "Successfully built " << ftsTable << " over " << count << " "
+            << contentTable << " records" << std::endl;
+  return true;
 }
@@ -0,0 +1,145 @@
+#include "services/transformers/BrandedFoodDimensionTransformer.h"
+#include "utils/Parallel.h"
+#include <iostream>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+using USDA::BrandedFood;
+
+/** Reads a column's value and points at the ID it is assigned */
+struct DimensionColumn {
+  std::optional<std::string_view> (*value)(const BrandedFood &);
+  int BrandedFood::*id;
+};
+
+std::optional<std::string_view>
+textOf(const std::optional<std::string> &value) {
+  if (!value) {
+    return std::nullopt;
+  }
+  return std::string_view(*value);
+}
+
+/** Columns in the order of BrandedFoodDimensionTransformer::COLUMNS */
+constexpr DimensionColumn DIMENSION_COLUMNS[] = {
+    {[](const BrandedFood &food) { return textOf(food.brand_owner); },
+     &BrandedFood::brand_owner_id},
+    {[](const BrandedFood &food) {
+       return textOf(food.branded_food_category);
+     },
+     &BrandedFood::branded_food_category_id},
+    {[](const BrandedFood &food) { return textOf(food.data_source); },
+     &BrandedFood::data_source_id},
+    {[](const BrandedFood &food) { return textOf(food.market_country); },
+     &BrandedFood::market_country_id},
+    // Normalized units are stored with their canonical symbol
+    {[](const BrandedFood &food) -> std::optional<std::string_view> {
+       if (food.serving_unit != USDA::Unit::Unknown) {
+         return USDA::UnitSymbol(food.serving_unit);
+       }
+       return textOf(food.serving_size_unit);
+     },
+     &BrandedFood::serving_size_unit_id}};
+
+static_assert(std::size(DIMENSION_COLUMNS) ==
+              BrandedFoodDimensionTransformer::DIMENSION_COUNT);
+
+/** Dictionary of one column built by one parallel chunk */
+struct ChunkDictionary {
+  // Keys view the rows' strings, which stay in place during the transform
+  std::unordered_map<std::string_view, int> local_ids;
+  std::vector<std::string_view> local_names;
+  std::vector<int> remap; ///< Global ID of every local ID, set by the merge
+};
+
+using ChunkResult =
+    std::array<ChunkDictionary,
+               BrandedFoodDimensionTransformer::DIMENSION_COUNT>;
+
+} // namespace
+
+void BrandedFoodDimensionTransformer::TransformData(
+    std::vector<USDA::BrandedFood> &branded_food_entries,
+    Dictionaries &dimension_entries) {
+  std::cout << "Starting Branded Food Dimension Transform...\n";
+
+  const std::size_t chunks = Parallel::ChunkCount(branded_food_entries.size());
+  std::vector<ChunkResult> results(chunks);
+
+  // Intern each chunk into private dictionaries so no locking is needed;
+  // rows temporarily hold their chunk-local IDs (1-based)
+  Parallel::ForEachChunk(
+      branded_food_entries.size(), chunks,
+      [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+        ChunkResult &result = results[chunk];
+
+        for (std::size_t i = begin; i < end; ++i) {
+          BrandedFood &branded_food = branded_food_entries[i];
+          for (std::size_t d = 0; d < DIMENSION_COUNT; ++d) {
+            const DimensionColumn &column = DIMENSION_COLUMNS[d];
+            const auto value = column.value(branded_food);
+            if (!value) {
+              branded_food.*column.id = 0;
+              continue;
+            }
+
+            ChunkDictionary &dictionary = result[d];
+            auto [it, inserted] = dictionary.local_ids.try_emplace(
+                *value, static_cast<int>(dictionary.local_names.size()) + 1);
+            if (inserted) {
+              dictionary.local_names.push_back(*value);
+            }
+            branded_food.*column.id = it->second;
+          }
+        }
+      });
+
+  // Merge the chunk dictionaries in input order; only distinct values are
+  // visited here, so this stays small next to the row passes
+  for (std::size_t d = 0; d < DIMENSION_COUNT; ++d) {
+    std::unordered_map<std::string_view, int> global_ids;
+    std::vector<USDA::DimensionValue> &values = dimension_entries[d];
+    values.clear();
+
+    for (ChunkResult &result : results) {
+      ChunkDictionary &dictionary = result[d];
+      dictionary.remap.resize(dictionary.local_names.size() + 1);
+      for (std::size_t local = 0; local < dictionary.local_names.size();
+           ++local) {
+        const std::string_view name = dictionary.local_names[local];
+        auto [it, inserted] = global_ids.try_emplace(
+            name, static_cast<int>(values.size()) + 1);
+        if (inserted) {
+          values.push_back({it->second, std::string(name)});
+        }
+        dictionary.remap[local + 1] = it->second;
+      }
+      dictionary.local_ids = {};
+      dictionary.local_names = {};
+    }
+  }
+
+  // Rewrite every row's chunk-local IDs to the merged ones
+  Parallel::ForEachChunk(
+      branded_food_entries.size(), chunks,
+      [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+        const ChunkResult &result = results[chunk];
+        for (std::size_t i = begin; i < end; ++i) {
+          BrandedFood &branded_food = branded_food_entries[i];
+          for (std::size_t d = 0; d < DIMENSION_COUNT; ++d) {
+            int &id = branded_food.*DIMENSION_COLUMNS[d].id;
+            id = result[d].remap[id]; // remap[0] keeps missing values at 0
+          }
+        }
+      });
+
+  // Transformation statistics
+  for (std::size_t d = 0; d < DIMENSION_COUNT; ++d) {
+    std::cout << "Found " << dimension_entries[d].size() << " distinct "
+              << COLUMNS[d] << " values\n";
+  }
+  std::cout << "\n";
+}
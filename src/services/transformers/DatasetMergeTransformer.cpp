@@ -0,0 +1,162 @@
+#include "services/transformers/DatasetMergeTransformer.h"
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <unordered_map>
+
+namespace {
+
+/** Where the kept copy of an FDC ID comes from */
+struct Owner {
+  std::size_t release;
+  std::chrono::year_month_day publication_date;
+};
+
+/** Marks an FDC ID in a release's removal bitmap */
+void markRemoved(std::vector<bool> &removed, int fdc_id) {
+  if (fdc_id < 0) {
+    return;
+  }
+  if (static_cast<std::size_t>(fdc_id) >= removed.size()) {
+    removed.resize(static_cast<std::size_t>(fdc_id) + 1, false);
+  }
+  removed[fdc_id] = true;
+}
+
+/** Removes every entry whose fdc_id is set in the bitmap */
+template <typename T>
+std::size_t eraseRemoved(std::vector<T> &entries,
+                         const std::vector<bool> &removed) {
+  if (removed.empty()) {
+    return 0;
+  }
+  const auto initial_size = entries.size();
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [&removed](const T &entry) {
+                                 return entry.fdc_id >= 0 &&
+                                        static_cast<std::size_t>(
+                                            entry.fdc_id) < removed.size() &&
+                                        removed[entry.fdc_id];
+                               }),
+                entries.end());
+  return initial_size - entries.size();
+}
+
+/** Moves the entries of `from` to the end of `to` */
+template <typename T> void append(std::vector<T> &to, std::vector<T> &from) {
+  if (to.empty()) {
+    to = std::move(from);
+  } else {
+    to.insert(to.end(), std::make_move_iterator(from.begin()),
+              std::make_move_iterator(from.end()));
+  }
+  from.clear();
+  from.shrink_to_fit();
+}
+
+} // namespace
+
+void DatasetMergeTransformer::TransformData(std::vector<Release> &releases) {
+  if (releases.empty()) {
+    return;
+  }
+  std::cout << "Starting Dataset Merge Transform...\n";
+
+  // One bitmap of removed FDC IDs per release, applied to all its tables
+  std::vector<std::vector<bool>> removed(releases.size());
+  std::vector<std::size_t> removed_by_type(releases.size(), 0);
+  std::vector<std::size_t> superseded(releases.size(), 0);
+
+  // Phase 1: keep only the food types each release is responsible for
+  for (std::size_t r = 0; r < releases.size(); ++r) {
+    const auto &data_types = releases[r].data_types;
+    for (const USDA::Food &food : releases[r].foods) {
+      if (std::find(data_types.begin(), data_types.end(), food.data_type) ==
+          data_types.end()) {
+        markRemoved(removed[r], food.fdc_id);
+        ++removed_by_type[r];
+      }
+    }
+  }
+
+  auto isRemoved = [&](std::size_t r, int fdc_id) {
+    return fdc_id >= 0 &&
+           static_cast<std::size_t>(fdc_id) < removed[r].size() &&
+           removed[r][fdc_id];
+  };
+
+  // Phase 2: resolve FDC IDs found in several releases. The additional
+  // releases are small, so only their IDs are hashed and the primary
+  // release is scanned against them
+  std::unordered_map<int, Owner> owners;
+  for (std::size_t r = 1; r < releases.size(); ++r) {
+    for (const USDA::Food &food : releases[r].foods) {
+      if (isRemoved(r, food.fdc_id)) {
+        continue;
+      }
+      auto [it, inserted] =
+          owners.try_emplace(food.fdc_id, Owner{r, food.publication_date});
+      if (inserted || it->second.release == r) {
+        continue;
+      }
+      // Releases are visited in order, so the current owner wins ties
+      if (food.publication_date > it->second.publication_date) {
+        markRemoved(removed[it->second.release], food.fdc_id);
+        ++superseded[it->second.release];
+        it->second = Owner{r, food.publication_date};
+      } else {
+        markRemoved(removed[r], food.fdc_id);
+        ++superseded[r];
+      }
+    }
+  }
+
+  if (!owners.empty()) {
+    for (const USDA::Food &food : releases[0].foods) {
+      auto it = owners.find(food.fdc_id);
+      if (it == owners.end() || isRemoved(0, food.fdc_id)) {
+        continue;
+      }
+      // The primary release precedes the others, so it wins ties
+      if (food.publication_date >= it->second.publication_date) {
+        markRemoved(removed[it->second.release], food.fdc_id);
+        ++superseded[it->second.release];
+      } else {
+        markRemoved(removed[0], food.fdc_id);
+        ++superseded[0];
+      }
+      owners.erase(it);
+    }
+  }
+  owners.clear();
+
+  // Phase 3: drop the removed foods with their rows, then concatenate
+  Release &merged = releases[0];
+  for (std::size_t r = 0; r < releases.size(); ++r) {
+    Release &release = releases[r];
+    eraseRemoved(release.foods, removed[r]);
+    eraseRemoved(release.food_nutrients, removed[r]);
+    eraseRemoved(release.food_portions, removed[r]);
+    eraseRemoved(release.food_attributes, removed[r]);
+    eraseRemoved(release.input_foods, removed[r]);
+    eraseRemoved(release.survey_fndds_foods, removed[r]);
+    removed[r] = {};
+
+    std::cout << "Release " << release.name << ": kept "
+              << release.foods.size() << " foods, removed "
+              << removed_by_type[r] << " of other data types and "
+              << superseded[r] << " superseded by another release\n";
+
+    if (r > 0) {
+      append(merged.foods, release.foods);
+      append(merged.food_nutrients, release.food_nutrients);
+      append(merged.food_portions, release.food_portions);
+      append(merged.food_attributes, release.food_attributes);
+      append(merged.input_foods, release.input_foods);
+      append(merged.survey_fndds_foods, release.survey_fndds_foods);
+    }
+  }
+
+  std::cout << "Merged " << releases.size() << " releases into "
+            << merged.foods.size() << " foods\n\n";
+}
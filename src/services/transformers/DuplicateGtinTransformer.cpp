@@ -0,0 +1,140 @@
+#include "services/transformers/DuplicateGtinTransformer.h"
+#include "services/transformers/GtinIndexTransformer.h"
+#include "utils/Parallel.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <tuple>
+#include <unordered_map>
+
+namespace {
+
+/** A branded food's position in the input, keyed by its normalized GTIN */
+struct GtinRef {
+  std::uint64_t gtin;
+  std::size_t index;
+};
+
+/** True if `a` is a more recent submission than `b` */
+bool isNewer(const USDA::BrandedFood &a, const USDA::BrandedFood &b) {
+  return std::tie(a.modified_date, a.available_date, a.fdc_id) >
+         std::tie(b.modified_date, b.available_date, b.fdc_id);
+}
+
+/** Removes every entry whose fdc_id is set in the bitmap */
+template <typename T>
+std::size_t eraseRemoved(std::vector<T> &entries,
+                         const std::vector<bool> &removed) {
+  const auto initial_size = entries.size();
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [&removed](const T &entry) {
+                                 return entry.fdc_id >= 0 &&
+                                        static_cast<std::size_t>(
+                                            entry.fdc_id) < removed.size() &&
+                                        removed[entry.fdc_id];
+                               }),
+                entries.end());
+  entries.shrink_to_fit();
+  return initial_size - entries.size();
+}
+
+} // namespace
+
+void DuplicateGtinTransformer::TransformData(
+    std::vector<USDA::BrandedFood> &branded_food_entries,
+    std::vector<USDA::Food> &food_entries,
+    std::vector<USDA::FoodNutrient> &food_nutrient_entries,
+    std::vector<USDA::FoodPortion> &food_portion_entries) {
+  std::cout << "Starting Duplicate GTIN Transform...\n";
+
+  const std::size_t chunks = Parallel::ChunkCount(branded_food_entries.size());
+  const std::size_t partitions = chunks;
+
+  // Phase 1: normalize GTINs and scatter them into per-chunk partitions
+  std::vector<std::vector<std::vector<GtinRef>>> scattered(
+      chunks, std::vector<std::vector<GtinRef>>(partitions));
+
+  Parallel::ForEachChunk(
+      branded_food_entries.size(), chunks,
+      [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+        auto &buckets = scattered[chunk];
+        for (std::size_t i = begin; i < end; ++i) {
+          const auto &gtin_upc = branded_food_entries[i].gtin_upc;
+          if (!gtin_upc) {
+            continue;
+          }
+          const auto gtin = GtinIndexTransformer::NormalizeGtin(*gtin_upc);
+          if (!gtin) {
+            continue;
+          }
+          // Fibonacci hashing spreads the mostly sequential UPC ranges evenly
+          const std::size_t partition =
+              ((*gtin * 0x9E3779B97F4A7C15ULL) >> 32) % partitions;
+          buckets[partition].push_back({*gtin, i});
+        }
+      });
+
+  // Phase 2: each partition picks the newest submission per GTIN
+  std::vector<std::vector<int>> losers(partitions);
+
+  Parallel::ForEachChunk(
+      partitions, partitions,
+      [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t partition = begin; partition < end; ++partition) {
+          std::unordered_map<std::uint64_t, std::size_t> winners;
+          for (const auto &buckets : scattered) {
+            for (const auto &ref : buckets[partition]) {
+              auto [it, inserted] = winners.try_emplace(ref.gtin, ref.index);
+              if (inserted) {
+                continue;
+              }
+              const auto &candidate = branded_food_entries[ref.index];
+              const auto &current = branded_food_entries[it->second];
+              if (isNewer(candidate, current)) {
+                losers[partition].push_back(current.fdc_id);
+                it->second = ref.index;
+              } else {
+                losers[partition].push_back(candidate.fdc_id);
+              }
+            }
+          }
+        }
+      });
+  scattered.clear();
+
+  // Phase 3: collect the superseded FDC IDs into one bitmap and apply it to
+  // every collection that references them
+  int max_fdc_id = -1;
+  for (const auto &partition_losers : losers) {
+    for (const int fdc_id : partition_losers) {
+      max_fdc_id = std::max(max_fdc_id, fdc_id);
+    }
+  }
+
+  std::vector<bool> removed(static_cast<std::size_t>(max_fdc_id + 1), false);
+  for (const auto &partition_losers : losers) {
+    for (const int fdc_id : partition_losers) {
+      if (fdc_id >= 0) {
+        removed[fdc_id] = true;
+      }
+    }
+  }
+
+  const auto removed_branded_food_count =
+      eraseRemoved(branded_food_entries, removed);
+  const auto removed_food_count = eraseRemoved(food_entries, removed);
+  const auto removed_food_nutrient_count =
+      eraseRemoved(food_nutrient_entries, removed);
+  const auto removed_food_portion_count =
+      eraseRemoved(food_portion_entries, removed);
+
+  // Transformation statistics
+  std::cout << "Removed " << removed_branded_food_count
+            << " superseded branded food entries\n";
+  std::cout << "Removed " << removed_food_count
+            << " food entries for superseded branded foods\n";
+  std::cout << "Removed " << removed_food_nutrient_count
+            << " food nutrient entries for superseded branded foods\n";
+  std::cout << "Removed " << removed_food_portion_count
+            << " food portion entries for superseded branded foods\n\n";
+}
@@ -0,0 +1,88 @@
+#include "services/transformers/GtinIndexTransformer.h"
+#include <algorithm>
+#include <iostream>
+
+std::optional<std::uint64_t>
+GtinIndexTransformer::NormalizeGtin(std::string_view raw) {
+  constexpr std::uint64_t MAX_GTIN = 99999999999999ULL; // 14 digits
+
+  std::uint64_t value = 0;
+  int digits = 0;
+
+  for (const char c : raw) {
+    if (c >= '0' && c <= '9') {
+      // Leading zeros still count towards the printed length, but only 14
+      // significant digits fit a GTIN
+      if (++digits > 19) {
+        return std::nullopt;
+      }
+      value = value * 10 + static_cast<std::uint64_t>(c - '0');
+    } else if (c != ' ' && c != '-') {
+      return std::nullopt;
+    }
+  }
+
+  if (digits < 8 || value == 0 || value > MAX_GTIN) {
+    return std::nullopt;
+  }
+
+  // GS1 mod-10: weights alternate 3, 1, 3, ... moving left from the digit
+  // next to the check digit. Implied leading zeros do not change the sum.
+  const auto check_digit = static_cast<unsigned>(value % 10);
+  unsigned sum = 0;
+  bool weight_three = true;
+  for (std::uint64_t body = value / 10; body != 0; body /= 10) {
+    const auto digit = static_cast<unsigned>(body % 10);
+    sum += weight_three ? digit * 3 : digit;
+    weight_three = !weight_three;
+  }
+
+  if ((10 - sum % 10) % 10 != check_digit) {
+    return std::nullopt;
+  }
+
+  return value;
+}
+
+void GtinIndexTransformer::TransformData(
+    const std::vector<USDA::BrandedFood> &branded_food_entries,
+    std::vector<USDA::GtinIndexEntry> &gtin_index_entries) {
+  std::cout << "Starting GTIN Index Transform...\n";
+
+  gtin_index_entries.clear();
+  gtin_index_entries.reserve(branded_food_entries.size());
+
+  std::size_t missing_count = 0;
+  std::size_t invalid_count = 0;
+
+  for (const auto &branded_food : branded_food_entries) {
+    if (!branded_food.gtin_upc) {
+      missing_count++;
+      continue;
+    }
+
+    const auto gtin = NormalizeGtin(*branded_food.gtin_upc);
+    if (!gtin) {
+      invalid_count++;
+      continue;
+    }
+
+    gtin_index_entries.push_back({*gtin, branded_food.fdc_id});
+  }
+
+  // Sorting the integer keys once lets consumers binary search the index
+  // (or mmap the exported file) instead of hashing strings
+  std::sort(gtin_index_entries.begin(), gtin_index_entries.end(),
+            [](const USDA::GtinIndexEntry &a, const USDA::GtinIndexEntry &b) {
+              return a.gtin != b.gtin ? a.gtin < b.gtin : a.fdc_id < b.fdc_id;
+            });
+
+  // Transformation statistics
+  std::cout << "Indexed " << gtin_index_entries.size() << " GTINs\n";
+  std::cout << "Skipped " << missing_count
+            << " branded food entries without a GTIN\n";
+  std::cout << "Skipped " << invalid_count
+            << " branded food entries with a malformed GTIN or check digit\n\n";
+
+  gtin_index_entries.shrink_to_fit();
+}
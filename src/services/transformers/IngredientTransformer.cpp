@@ -0,0 +1,168 @@
+#include "services/transformers/IngredientTransformer.h"
+#include "utils/Parallel.h"
+#include <iostream>
+#include <unordered_map>
+
+namespace {
+
+/** Characters trimmed from both ends of an ingredient name */
+constexpr bool isTrimmed(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '.' ||
+         c == '*' || c == '"';
+}
+
+/** Characters that end one ingredient and start the next */
+constexpr bool isSeparator(char c) {
+  return c == ',' || c == ';' || c == '(' || c == ')' || c == '[' ||
+         c == ']';
+}
+
+/**
+ * Normalizes one raw ingredient into `name`, reusing its capacity.
+ * Returns false if nothing is left after trimming.
+ */
+bool normalizeIngredient(std::string_view raw, std::string &name) {
+  // "CONTAINS 2% OR LESS OF: SALT" -> "SALT"
+  const auto colon = raw.rfind(':');
+  if (colon != std::string_view::npos) {
+    raw.remove_prefix(colon + 1);
+  }
+
+  while (!raw.empty() && isTrimmed(raw.front())) {
+    raw.remove_prefix(1);
+  }
+  while (!raw.empty() && isTrimmed(raw.back())) {
+    raw.remove_suffix(1);
+  }
+
+  name.clear();
+  bool pending_space = false;
+  for (const char c : raw) {
+    if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+      pending_space = true;
+      continue;
+    }
+    if (pending_space) {
+      name.push_back(' ');
+      pending_space = false;
+    }
+    // ASCII fast path; UTF-8 continuation bytes are copied unchanged
+    name.push_back(c >= 'A' && c <= 'Z' ? static_cast<char>(c | 0x20) : c);
+  }
+
+  if (name.compare(0, 4, "and ") == 0) {
+    name.erase(0, 4);
+  }
+
+  return !name.empty();
+}
+
+/** Invokes fn(const std::string &name) for each ingredient in the label */
+template <typename Fn>
+void forEachIngredient(std::string_view label, std::string &scratch, Fn &&fn) {
+  std::size_t start = 0;
+  for (std::size_t i = 0; i <= label.size(); ++i) {
+    if (i == label.size() || isSeparator(label[i])) {
+      if (normalizeIngredient(label.substr(start, i - start), scratch)) {
+        fn(scratch);
+      }
+      start = i + 1;
+    }
+  }
+}
+
+/** Dictionary and links produced by one parallel chunk */
+struct ChunkResult {
+  std::unordered_map<std::string, int> local_ids;
+  std::vector<const std::string *> local_names;
+  std::vector<USDA::BrandedFoodIngredient> links;
+};
+
+} // namespace
+
+void IngredientTransformer::TokenizeIngredients(
+    std::string_view label, std::vector<std::string> &ingredients) {
+  std::string scratch;
+  forEachIngredient(label, scratch, [&ingredients](const std::string &name) {
+    ingredients.push_back(name);
+  });
+}
+
+void IngredientTransformer::TransformData(
+    const std::vector<USDA::BrandedFood> &branded_food_entries,
+    std::vector<USDA::Ingredient> &ingredient_entries,
+    std::vector<USDA::BrandedFoodIngredient> &branded_food_ingredient_entries) {
+  std::cout << "Starting Ingredient Transform...\n";
+
+  const std::size_t chunks = Parallel::ChunkCount(branded_food_entries.size());
+  std::vector<ChunkResult> results(chunks);
+
+  // Tokenize each chunk into a private dictionary so no locking is needed
+  Parallel::ForEachChunk(
+      branded_food_entries.size(), chunks,
+      [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+        ChunkResult &result = results[chunk];
+        std::string scratch;
+
+        for (std::size_t i = begin; i < end; ++i) {
+          const auto &branded_food = branded_food_entries[i];
+          if (!branded_food.ingredients) {
+            continue;
+          }
+
+          int position = 0;
+          forEachIngredient(
+              *branded_food.ingredients, scratch,
+              [&](const std::string &name) {
+                auto [it, inserted] = result.local_ids.try_emplace(
+                    name, static_cast<int>(result.local_names.size()));
+                if (inserted) {
+                  result.local_names.push_back(&it->first);
+                }
+                result.links.push_back(
+                    {branded_food.fdc_id, it->second, ++position});
+              });
+        }
+      });
+
+  // Merge the chunk dictionaries in input order, remapping local IDs to
+  // global IDs (1-based, in order of first appearance)
+  std::unordered_map<std::string, int> global_ids;
+  std::size_t total_links = 0;
+  for (const auto &result : results) {
+    total_links += result.links.size();
+  }
+
+  ingredient_entries.clear();
+  branded_food_ingredient_entries.clear();
+  branded_food_ingredient_entries.reserve(total_links);
+
+  for (auto &result : results) {
+    std::vector<int> remap(result.local_names.size());
+    for (std::size_t local = 0; local < result.local_names.size(); ++local) {
+      const std::string &name = *result.local_names[local];
+      auto [it, inserted] = global_ids.try_emplace(
+          name, static_cast<int>(ingredient_entries.size()) + 1);
+      if (inserted) {
+        ingredient_entries.push_back({it->second, name});
+      }
+      remap[local] = it->second;
+    }
+
+    for (auto link : result.links) {
+      link.ingredient_id = remap[link.ingredient_id];
+      branded_food_ingredient_entries.push_back(link);
+    }
+
+    // Release each chunk as soon as it has been merged
+    result = ChunkResult{};
+  }
+
+  // Transformation statistics
+  std::cout << "Found " << ingredient_entries.size()
+            << " distinct ingredients\n";
+  std::cout << "Linked " << branded_food_ingredient_entries.size()
+            << " branded food ingredient entries\n\n";
+
+  ingredient_entries.shrink_to_fit();
+}
@@ -0,0 +1,168 @@
+#include "services/transformers/NutrientCategoryStatsTransformer.h"
+#include "utils/Parallel.h"
+#include "utils/QuantileSketch.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+
+namespace {
+
+constexpr const char *FOOD_CATEGORY = "food_category";
+constexpr const char *BRANDED_FOOD_CATEGORY = "branded_food_category";
+
+/** Partial aggregate of one (category, nutrient) group */
+struct GroupStats {
+  double sum = 0.0;
+  QuantileSketch sketch;
+};
+
+using GroupMap = std::unordered_map<std::uint64_t, GroupStats>;
+
+/** Group key of a category number and nutrient */
+inline std::uint64_t groupKey(std::int32_t category, int nutrient_id) {
+  return static_cast<std::uint64_t>(static_cast<std::uint32_t>(category))
+             << 32 |
+         static_cast<std::uint32_t>(nutrient_id);
+}
+
+/** Numbers the distinct categories of one category type */
+class CategoryNumbering {
+public:
+  CategoryNumbering(const char *type,
+                    std::vector<std::pair<const char *, std::string>> &names)
+      : type(type), names(names) {}
+
+  /** Returns the number of a category, assigning one on first use */
+  std::int32_t Number(const std::string &category) {
+    auto [it, inserted] = numbers.try_emplace(
+        category, static_cast<std::int32_t>(names.size()));
+    if (inserted) {
+      names.emplace_back(type, category);
+    }
+    return it->second;
+  }
+
+private:
+  const char *type;
+  std::vector<std::pair<const char *, std::string>> &names;
+  std::unordered_map<std::string_view, std::int32_t> numbers;
+};
+
+} // namespace
+
+void NutrientCategoryStatsTransformer::TransformData(
+    const std::vector<USDA::Food> &food_entries,
+    const std::vector<USDA::BrandedFood> &branded_food_entries,
+    const std::vector<USDA::FoodNutrient> &food_nutrient_entries,
+    std::vector<USDA::NutrientCategoryStat> &nutrient_category_stat_entries) {
+  std::cout << "Starting Nutrient Category Stats Transform...\n";
+
+  // Phase 1: number the categories and map every FDC ID to its categories.
+  // The numbering's keys view the entries' strings, which outlive it
+  std::vector<std::pair<const char *, std::string>> category_names;
+  CategoryNumbering food_categories(FOOD_CATEGORY, category_names);
+  CategoryNumbering branded_food_categories(BRANDED_FOOD_CATEGORY,
+                                            category_names);
+
+  int max_fdc_id = -1;
+  for (const auto &food : food_entries) {
+    max_fdc_id = std::max(max_fdc_id, food.fdc_id);
+  }
+  for (const auto &branded_food : branded_food_entries) {
+    max_fdc_id = std::max(max_fdc_id, branded_food.fdc_id);
+  }
+
+  const auto fdc_id_count = static_cast<std::size_t>(max_fdc_id + 1);
+  std::vector<std::int32_t> food_category_of(fdc_id_count, -1);
+  std::vector<std::int32_t> branded_food_category_of(fdc_id_count, -1);
+
+  for (const auto &food : food_entries) {
+    if (food.fdc_id >= 0 && food.food_category_id &&
+        !food.food_category_id->empty()) {
+      food_category_of[food.fdc_id] =
+          food_categories.Number(*food.food_category_id);
+    }
+  }
+  for (const auto &branded_food : branded_food_entries) {
+    if (branded_food.fdc_id >= 0 && branded_food.branded_food_category &&
+        !branded_food.branded_food_category->empty()) {
+      branded_food_category_of[branded_food.fdc_id] =
+          branded_food_categories.Number(*branded_food.branded_food_category);
+    }
+  }
+
+  // Phase 2: thread-local partial aggregates over row ranges
+  const std::size_t chunks =
+      Parallel::ChunkCount(food_nutrient_entries.size());
+  std::vector<GroupMap> partials(chunks);
+
+  Parallel::ForEachChunk(
+      food_nutrient_entries.size(), chunks,
+      [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+        GroupMap &groups = partials[chunk];
+        auto add = [&groups](std::int32_t category, int nutrient_id,
+                             double amount) {
+          GroupStats &stats = groups[groupKey(category, nutrient_id)];
+          stats.sum += amount;
+          stats.sketch.Add(amount);
+        };
+
+        for (std::size_t i = begin; i < end; ++i) {
+          const USDA::FoodNutrient &food_nutrient = food_nutrient_entries[i];
+          const auto fdc_id = static_cast<std::size_t>(food_nutrient.fdc_id);
+          if (!food_nutrient.amount || food_nutrient.fdc_id < 0 ||
+              fdc_id >= fdc_id_count) {
+            continue;
+          }
+          const double amount = *food_nutrient.amount;
+          if (food_category_of[fdc_id] >= 0) {
+            add(food_category_of[fdc_id], food_nutrient.nutrient_id, amount);
+          }
+          if (branded_food_category_of[fdc_id] >= 0) {
+            add(branded_food_category_of[fdc_id], food_nutrient.nutrient_id,
+                amount);
+          }
+        }
+      });
+
+  // Phase 3: merge the partial aggregates chunk by chunk
+  GroupMap merged = std::move(partials.front());
+  for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+    for (auto &[key, stats] : partials[chunk]) {
+      auto [it, inserted] = merged.try_emplace(key, std::move(stats));
+      if (!inserted) {
+        it->second.sum += stats.sum;
+        it->second.sketch.Merge(stats.sketch);
+      }
+    }
+    partials[chunk] = {};
+  }
+
+  nutrient_category_stat_entries.clear();
+  nutrient_category_stat_entries.reserve(merged.size());
+  for (const auto &[key, stats] : merged) {
+    const auto &[type, category] = category_names[key >> 32];
+    const auto count = stats.sketch.Count();
+    nutrient_category_stat_entries.push_back(
+        {type, category, static_cast<int>(static_cast<std::uint32_t>(key)),
+         static_cast<int>(count), stats.sum / static_cast<double>(count),
+         stats.sketch.Quantile(0.1), stats.sketch.Quantile(0.5),
+         stats.sketch.Quantile(0.9)});
+  }
+
+  std::sort(nutrient_category_stat_entries.begin(),
+            nutrient_category_stat_entries.end(),
+            [](const USDA::NutrientCategoryStat &a,
+               const USDA::NutrientCategoryStat &b) {
+              return std::tie(a.category_type, a.category, a.nutrient_id) <
+                     std::tie(b.category_type, b.category, b.nutrient_id);
+            });
+
+  // Transformation statistics
+  std::cout << "Summarized " << category_names.size() << " categories into "
+            << nutrient_category_stat_entries.size()
+            << " nutrient category stats entries\n\n";
+}
@@ -0,0 +1,95 @@
+#include "services/transformers/PerServingNutrientTransformer.h"
+#include "utils/Parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+void PerServingNutrientTransformer::TransformData(
+    const std::vector<USDA::BrandedFood> &branded_food_entries,
+    std::vector<USDA::FoodNutrient> &food_nutrient_entries) {
+  std::cout << "Starting Per-Serving Nutrient Transform...\n";
+
+  constexpr float NOT_AVAILABLE = std::numeric_limits<float>::quiet_NaN();
+
+  // Dense FDC ID -> (serving size / 100) lookup; NaN propagates through the
+  // multiplication below, which replaces per-row null checks
+  int max_fdc_id = -1;
+  for (const auto &branded_food : branded_food_entries) {
+    max_fdc_id = std::max(max_fdc_id, branded_food.fdc_id);
+  }
+
+  std::vector<float> scale_by_fdc_id(static_cast<std::size_t>(max_fdc_id + 1),
+                                     NOT_AVAILABLE);
+  for (const auto &branded_food : branded_food_entries) {
+    const auto dimension = USDA::DimensionOf(branded_food.serving_unit);
+    if (branded_food.fdc_id < 0 || !branded_food.serving_size ||
+        (dimension != USDA::UnitDimension::Mass &&
+         dimension != USDA::UnitDimension::Volume)) {
+      continue;
+    }
+    scale_by_fdc_id[branded_food.fdc_id] = static_cast<float>(
+        *branded_food.serving_size *
+        USDA::BaseUnitsPer(branded_food.serving_unit) / 100.0);
+  }
+
+  const std::size_t chunks =
+      Parallel::ChunkCount(food_nutrient_entries.size());
+  std::vector<std::size_t> computed_counts(chunks, 0);
+
+  Parallel::ForEachChunk(
+      food_nutrient_entries.size(), chunks,
+      [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+        // Small enough to stay in L1 while the three passes run over it
+        constexpr std::size_t BLOCK_SIZE = 1024;
+        float amounts[BLOCK_SIZE];
+        float scales[BLOCK_SIZE];
+        float results[BLOCK_SIZE];
+
+        const auto *scale_table = scale_by_fdc_id.data();
+        const auto scale_table_size =
+            static_cast<unsigned>(scale_by_fdc_id.size());
+        std::size_t computed_count = 0;
+
+        for (std::size_t block = begin; block < end; block += BLOCK_SIZE) {
+          const std::size_t n = std::min(BLOCK_SIZE, end - block);
+          USDA::FoodNutrient *rows = &food_nutrient_entries[block];
+
+          // Gather into contiguous columns
+          for (std::size_t i = 0; i < n; ++i) {
+            amounts[i] = rows[i].amount.value_or(NOT_AVAILABLE);
+            const auto fdc_id = static_cast<unsigned>(rows[i].fdc_id);
+            scales[i] = fdc_id < scale_table_size ? scale_table[fdc_id]
+                                                  : NOT_AVAILABLE;
+          }
+
+          // Branch-free kernel over contiguous floats
+          for (std::size_t i = 0; i < n; ++i) {
+            results[i] = amounts[i] * scales[i];
+          }
+
+          // Scatter back; NaN marks a missing input
+          for (std::size_t i = 0; i < n; ++i) {
+            if (std::isnan(results[i])) {
+              rows[i].amount_per_serving.reset();
+            } else {
+              rows[i].amount_per_serving = results[i];
+              computed_count++;
+            }
+          }
+        }
+
+        computed_counts[chunk] = computed_count;
+      });
+
+  std::size_t computed_total = 0;
+  for (const auto count : computed_counts) {
+    computed_total += count;
+  }
+
+  // Transformation statistics
+  std::cout << "Computed " << computed_total
+            << " per-serving food nutrient amounts\n";
+  std::cout << "Skipped " << food_nutrient_entries.size() - computed_total
+            << " food nutrient entries without an amount or serving size\n\n";
+}
@@ -0,0 +1,79 @@
+#include "services/transformers/UnitNormalizationTransformer.h"
+#include <algorithm>
+#include <iostream>
+
+void UnitNormalizationTransformer::TransformData(
+    std::vector<USDA::BrandedFood> &branded_food_entries,
+    std::vector<USDA::Nutrient> &nutrient_entries,
+    std::vector<USDA::MeasureUnit> &measure_unit_entries,
+    std::vector<USDA::FoodPortion> &food_portion_entries) {
+  std::cout << "Starting Unit Normalization Transform...\n";
+
+  // Serving units: the enum replaces the raw string whenever it is known
+  std::size_t unknown_serving_unit_count = 0;
+  for (auto &branded_food : branded_food_entries) {
+    if (!branded_food.serving_size_unit) {
+      continue;
+    }
+    branded_food.serving_unit = ParseUnit(*branded_food.serving_size_unit);
+    if (branded_food.serving_unit != USDA::Unit::Unknown) {
+      branded_food.serving_size_unit.reset();
+    } else {
+      unknown_serving_unit_count++;
+    }
+  }
+
+  std::size_t unknown_nutrient_unit_count = 0;
+  for (auto &nutrient : nutrient_entries) {
+    nutrient.unit = ParseUnit(nutrient.unit_name);
+    if (nutrient.unit == USDA::Unit::Unknown) {
+      unknown_nutrient_unit_count++;
+    }
+  }
+
+  // Measure unit IDs are small and dense, so index the units directly by ID
+  int max_measure_unit_id = -1;
+  for (auto &measure_unit : measure_unit_entries) {
+    measure_unit.unit = ParseUnit(measure_unit.name);
+    max_measure_unit_id = std::max(max_measure_unit_id, measure_unit.id);
+  }
+
+  std::vector<USDA::Unit> unit_by_measure_unit_id(
+      static_cast<std::size_t>(max_measure_unit_id + 1), USDA::Unit::Unknown);
+  for (const auto &measure_unit : measure_unit_entries) {
+    if (measure_unit.id >= 0) {
+      unit_by_measure_unit_id[measure_unit.id] = measure_unit.unit;
+    }
+  }
+
+  // Portions measured in a mass unit have a derivable gram weight
+  std::size_t derived_gram_weight_count = 0;
+  for (auto &food_portion : food_portion_entries) {
+    if (food_portion.gram_weight || !food_portion.amount ||
+        !food_portion.measure_unit_id) {
+      continue;
+    }
+
+    const int measure_unit_id = *food_portion.measure_unit_id;
+    if (measure_unit_id < 0 ||
+        static_cast<std::size_t>(measure_unit_id) >=
+            unit_by_measure_unit_id.size()) {
+      continue;
+    }
+
+    const USDA::Unit unit = unit_by_measure_unit_id[measure_unit_id];
+    if (USDA::DimensionOf(unit) == USDA::UnitDimension::Mass) {
+      food_portion.gram_weight = static_cast<float>(
+          *food_portion.amount * USDA::BaseUnitsPer(unit));
+      derived_gram_weight_count++;
+    }
+  }
+
+  // Transformation statistics
+  std::cout << "Found " << unknown_serving_unit_count
+            << " branded food entries with an unrecognized serving unit\n";
+  std::cout << "Found " << unknown_nutrient_unit_count
+            << " nutrient entries with an unrecognized unit\n";
+  std::cout << "Derived " << derived_gram_weight_count
+            << " food portion gram weights from mass units\n\n";
+}
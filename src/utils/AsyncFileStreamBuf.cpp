@@ -0,0 +1,424 @@
+#include "utils/AsyncFileStreamBuf.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup) &&       \
+    defined(__NR_io_uring_enter)
+#include <linux/io_uring.h>
+#define USDA_HAVE_IO_URING 1
+#endif
+
+#ifdef USDA_HAVE_IO_URING
+
+/** Submission and completion rings shared with the kernel */
+struct AsyncFileStreamBuf::Ring {
+  int fd = -1;
+  void *sq_ptr = MAP_FAILED;
+  std::size_t sq_size = 0;
+  void *cq_ptr = MAP_FAILED;
+  std::size_t cq_size = 0;
+  io_uring_sqe *sqes = static_cast<io_uring_sqe *>(MAP_FAILED);
+  std::size_t sqes_size = 0;
+
+  unsigned *sq_tail = nullptr;
+  unsigned *sq_mask = nullptr;
+  unsigned *sq_array = nullptr;
+  unsigned *cq_head = nullptr;
+  unsigned *cq_tail = nullptr;
+  unsigned *cq_mask = nullptr;
+  io_uring_cqe *cqes = nullptr;
+};
+
+#else
+
+struct AsyncFileStreamBuf::Ring {};
+
+#endif
+
+AsyncFileStreamBuf::AsyncFileStreamBuf(const std::string &path,
+                                       Backend backend,
+                                       std::size_t block_size, unsigned depth)
+    : path(path), backend(backend), block_size(block_size),
+      blocks(std::max(depth, 2u)) {
+  fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  struct stat info {};
+  if (fd < 0 || ::fstat(fd, &info) != 0) {
+    std::cerr << "Failed to open input file: " << path << " ("
+              << std::strerror(errno) << ")" << std::endl;
+    failed = true;
+    return;
+  }
+  file_size = static_cast<std::uint64_t>(info.st_size);
+
+  // Let the kernel read ahead aggressively as well
+  ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+  for (auto &block : blocks) {
+    block.data.reset(new char[block_size]);
+  }
+
+  if (backend == Backend::IoUring && !setupRing()) {
+    this->backend = Backend::Pread;
+  }
+
+  if (this->backend == Backend::IoUring) {
+    for (auto &block : blocks) {
+      schedule(block);
+    }
+  } else {
+    reader = std::thread(&AsyncFileStreamBuf::readahead, this);
+  }
+}
+
+AsyncFileStreamBuf::~AsyncFileStreamBuf() {
+  if (reader.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      cancelled = true;
+    }
+    block_free.notify_all();
+    reader.join();
+  }
+
+  if (ring) {
+    // The kernel may still be writing into the blocks, so let those reads
+    // finish before the buffers are released
+    for (auto &block : blocks) {
+      block.length = block.filled;
+    }
+    while (std::any_of(blocks.begin(), blocks.end(),
+                       [](const Block &block) { return block.pending; }) &&
+           reapCompletions(true)) {
+    }
+    teardownRing();
+  }
+
+  if (fd >= 0) {
+    ::close(fd);
+  }
+}
+
+bool AsyncFileStreamBuf::Failed() const { return failed; }
+
+AsyncFileStreamBuf::int_type AsyncFileStreamBuf::underflow() {
+  if (gptr() < egptr()) {
+    return traits_type::to_int_type(*gptr());
+  }
+
+  // Hand the block the consumer has finished with back to the reader
+  if (exposed) {
+    exposed = false;
+    setg(nullptr, nullptr, nullptr);
+    if (backend == Backend::IoUring) {
+      schedule(blocks[current]);
+    } else {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        blocks[current].ready = false;
+      }
+      block_free.notify_one();
+    }
+    current = (current + 1) % blocks.size();
+  }
+
+  if (failed || consumed_offset >= file_size) {
+    return traits_type::eof();
+  }
+
+  Block &block = blocks[current];
+  if (!await(block)) {
+    return traits_type::eof();
+  }
+
+  consumed_offset = block.offset + block.length;
+  exposed = true;
+  setg(block.data.get(), block.data.get(), block.data.get() + block.length);
+  return traits_type::to_int_type(*gptr());
+}
+
+void AsyncFileStreamBuf::schedule(Block &block) {
+  block.offset = next_offset;
+  block.length = static_cast<std::size_t>(
+      std::min<std::uint64_t>(block_size, file_size - next_offset));
+  block.filled = 0;
+  block.ready = false;
+  next_offset += block.length;
+
+  // Past the end of the file there is nothing left to read into this block
+  if (block.length > 0 &&
+      !submitRead(static_cast<std::size_t>(&block - blocks.data()))) {
+    failed = true;
+  }
+}
+
+bool AsyncFileStreamBuf::await(Block &block) {
+  if (backend == Backend::IoUring) {
+    while (!block.ready && !failed) {
+      if (!reapCompletions(true)) {
+        failed = true;
+      }
+    }
+    return !failed;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  block_ready.wait(lock, [&] { return block.ready || failed; });
+  return block.ready;
+}
+
+void AsyncFileStreamBuf::readahead() {
+  for (std::size_t slot = 0; next_offset < file_size;
+       slot = (slot + 1) % blocks.size()) {
+    Block &block = blocks[slot];
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      block_free.wait(lock, [&] { return !block.ready || cancelled; });
+      if (cancelled) {
+        return;
+      }
+    }
+
+    // The block is free, so the consumer does not touch it until it is ready
+    block.offset = next_offset;
+    block.length = static_cast<std::size_t>(
+        std::min<std::uint64_t>(block_size, file_size - next_offset));
+    next_offset += block.length;
+
+    std::size_t filled = 0;
+    while (filled < block.length) {
+      const ssize_t n =
+          ::pread(fd, block.data.get() + filled, block.length - filled,
+                  static_cast<off_t>(block.offset + filled));
+      if (n < 0 && errno == EINTR) {
+        continue;
+      }
+      if (n <= 0) {
+        std::cerr << "Failed to read input file: " << path << " ("
+                  << (n < 0 ? std::strerror(errno) : "unexpected end of file")
+                  << ")" << std::endl;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          failed = true;
+        }
+        block_ready.notify_one();
+        return;
+      }
+      filled += static_cast<std::size_t>(n);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      block.ready = true;
+    }
+    block_ready.notify_one();
+  }
+}
+
+#ifdef USDA_HAVE_IO_URING
+
+namespace {
+
+int ioUringSetup(unsigned entries, io_uring_params *params) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int ioUringEnter(int fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit,
+                                    min_complete, flags, nullptr, 0));
+}
+
+} // namespace
+
+bool AsyncFileStreamBuf::setupRing() {
+  auto r = std::make_unique<Ring>();
+
+  io_uring_params params{};
+  r->fd = ioUringSetup(static_cast<unsigned>(blocks.size()), &params);
+  if (r->fd < 0) {
+    static std::once_flag reported;
+    const int error = errno;
+    std::call_once(reported, [error] {
+      std::cerr << "io_uring is unavailable (" << std::strerror(error)
+                << "), falling back to pread" << std::endl;
+    });
+    return false;
+  }
+  ring = std::move(r);
+
+  Ring &rg = *ring;
+  rg.sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  rg.cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap) {
+    rg.sq_size = rg.cq_size = std::max(rg.sq_size, rg.cq_size);
+  }
+
+  rg.sq_ptr = ::mmap(nullptr, rg.sq_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, rg.fd, IORING_OFF_SQ_RING);
+  if (rg.sq_ptr == MAP_FAILED) {
+    teardownRing();
+    return false;
+  }
+  if (single_mmap) {
+    rg.cq_ptr = rg.sq_ptr;
+  } else {
+    rg.cq_ptr = ::mmap(nullptr, rg.cq_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, rg.fd, IORING_OFF_CQ_RING);
+    if (rg.cq_ptr == MAP_FAILED) {
+      teardownRing();
+      return false;
+    }
+  }
+
+  rg.sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  rg.sqes = static_cast<io_uring_sqe *>(
+      ::mmap(nullptr, rg.sqes_size, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, rg.fd, IORING_OFF_SQES));
+  if (rg.sqes == MAP_FAILED) {
+    teardownRing();
+    return false;
+  }
+
+  auto *sq = static_cast<char *>(rg.sq_ptr);
+  auto *cq = static_cast<char *>(rg.cq_ptr);
+  rg.sq_tail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+  rg.sq_mask = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+  rg.sq_array = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+  rg.cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+  rg.cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+  rg.cq_mask = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+  rg.cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+  return true;
+}
+
+void AsyncFileStreamBuf::teardownRing() {
+  if (!ring) {
+    return;
+  }
+  Ring &rg = *ring;
+  if (rg.sqes != MAP_FAILED) {
+    ::munmap(rg.sqes, rg.sqes_size);
+  }
+  if (rg.cq_ptr != MAP_FAILED && rg.cq_ptr != rg.sq_ptr) {
+    ::munmap(rg.cq_ptr, rg.cq_size);
+  }
+  if (rg.sq_ptr != MAP_FAILED) {
+    ::munmap(rg.sq_ptr, rg.sq_size);
+  }
+  if (rg.fd >= 0) {
+    ::close(rg.fd);
+  }
+  ring.reset();
+}
+
+bool AsyncFileStreamBuf::submitRead(std::size_t slot) {
+  Ring &rg = *ring;
+  Block &block = blocks[slot];
+  block.vector.iov_base = block.data.get() + block.filled;
+  block.vector.iov_len = block.length - block.filled;
+
+  // At most one read per block is in flight, so the ring is never full
+  const unsigned tail = *rg.sq_tail;
+  const unsigned index = tail & *rg.sq_mask;
+  io_uring_sqe &sqe = rg.sqes[index];
+  std::memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_READV;
+  sqe.fd = fd;
+  sqe.addr = reinterpret_cast<std::uint64_t>(&block.vector);
+  sqe.len = 1;
+  sqe.off = block.offset + block.filled;
+  sqe.user_data = slot;
+  rg.sq_array[index] = index;
+  __atomic_store_n(rg.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  block.pending = true;
+
+  int submitted;
+  do {
+    submitted = ioUringEnter(rg.fd, 1, 0, 0);
+  } while (submitted < 0 && (errno == EINTR || errno == EAGAIN));
+
+  if (submitted < 0) {
+    block.pending = false;
+    std::cerr << "Failed to queue read of input file: " << path << " ("
+              << std::strerror(errno) << ")" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool AsyncFileStreamBuf::reapCompletions(bool wait) {
+  Ring &rg = *ring;
+
+  if (wait) {
+    int result;
+    do {
+      result = ioUringEnter(rg.fd, 0, 1, IORING_ENTER_GETEVENTS);
+    } while (result < 0 && errno == EINTR);
+    if (result < 0) {
+      std::cerr << "Failed to wait for input file reads: " << path << " ("
+                << std::strerror(errno) << ")" << std::endl;
+      return false;
+    }
+  }
+
+  bool ok = true;
+  unsigned head = *rg.cq_head;
+  const unsigned tail = __atomic_load_n(rg.cq_tail, __ATOMIC_ACQUIRE);
+  for (; head != tail; ++head) {
+    const io_uring_cqe &cqe = rg.cqes[head & *rg.cq_mask];
+    Block &block = blocks[static_cast<std::size_t>(cqe.user_data)];
+    block.pending = false;
+
+    if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+      ok = submitRead(static_cast<std::size_t>(cqe.user_data)) && ok;
+      continue;
+    }
+    if (cqe.res <= 0) {
+      if (block.filled < block.length) {
+        std::cerr << "Failed to read input file: " << path << " ("
+                  << (cqe.res < 0 ? std::strerror(-cqe.res)
+                                  : "unexpected end of file")
+                  << ")" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+
+    // Short reads are continued from where they stopped
+    block.filled += static_cast<std::size_t>(cqe.res);
+    if (block.filled < block.length) {
+      ok = submitRead(static_cast<std::size_t>(cqe.user_data)) && ok;
+    } else {
+      block.ready = true;
+    }
+  }
+  __atomic_store_n(rg.cq_head, head, __ATOMIC_RELEASE);
+  return ok;
+}
+
+#else
+
+bool AsyncFileStreamBuf::setupRing() {
+  static std::once_flag reported;
+  std::call_once(reported, [] {
+    std::cerr << "Built without io_uring support, falling back to pread"
+              << std::endl;
+  });
+  return false;
+}
+
+void AsyncFileStreamBuf::teardownRing() {}
+
+bool AsyncFileStreamBuf::submitRead(std::size_t) { return false; }
+
+bool AsyncFileStreamBuf::reapCompletions(bool) { return false; }
+
+#endif
@@ -0,0 +1,437 @@
+#include "utils/DecompressingStreamBuf.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <zlib.h>
+
+namespace {
+
+constexpr std::size_t READ_CHUNK_SIZE = 1024 * 1024;
+constexpr std::size_t GET_AREA_SIZE = 1024 * 1024;
+
+std::uint16_t readU16(const unsigned char *p) {
+  return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+}
+
+std::uint32_t readU32(const unsigned char *p) {
+  return static_cast<std::uint32_t>(p[0]) |
+         (static_cast<std::uint32_t>(p[1]) << 8) |
+         (static_cast<std::uint32_t>(p[2]) << 16) |
+         (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+std::uint64_t readU64(const unsigned char *p) {
+  return static_cast<std::uint64_t>(readU32(p)) |
+         (static_cast<std::uint64_t>(readU32(p + 4)) << 32);
+}
+
+/** Location of a member's data inside a zip archive */
+struct ZipEntry {
+  std::uint16_t method = 0;
+  std::uint64_t compressed_size = 0;
+  std::uint64_t local_header_offset = 0;
+};
+
+/** True if the zip member path equals `member` or ends with "/member" */
+bool memberMatches(const std::string &name, const std::string &member) {
+  if (name == member) {
+    return true;
+  }
+  return name.size() > member.size() &&
+         name.compare(name.size() - member.size(), member.size(), member) ==
+             0 &&
+         name[name.size() - member.size() - 1] == '/';
+}
+
+/** Reads the central directory and finds the requested member */
+bool findZipEntry(std::ifstream &in, const std::string &path,
+                  const std::string &member, ZipEntry &entry) {
+  in.seekg(0, std::ios::end);
+  const auto file_size = static_cast<std::uint64_t>(in.tellg());
+
+  // The end of central directory record is in the last 64 KiB + 22 bytes
+  const std::uint64_t tail_size =
+      std::min<std::uint64_t>(file_size, 65536 + 22);
+  std::vector<unsigned char> tail(tail_size);
+  in.seekg(static_cast<std::streamoff>(file_size - tail_size));
+  in.read(reinterpret_cast<char *>(tail.data()),
+          static_cast<std::streamsize>(tail_size));
+  if (!in) {
+    std::cerr << "Failed to read zip directory: " << path << std::endl;
+    return false;
+  }
+
+  std::size_t eocd = tail_size;
+  for (std::size_t i = tail_size >= 22 ? tail_size - 22 + 1 : 0; i-- > 0;) {
+    if (readU32(&tail[i]) == 0x06054b50) {
+      eocd = i;
+      break;
+    }
+  }
+  if (eocd == tail_size) {
+    std::cerr << "Not a zip archive: " << path << std::endl;
+    return false;
+  }
+
+  std::uint64_t entry_count = readU16(&tail[eocd + 10]);
+  std::uint64_t directory_size = readU32(&tail[eocd + 12]);
+  std::uint64_t directory_offset = readU32(&tail[eocd + 16]);
+
+  // ZIP64: the locator directly precedes the end of central directory record
+  if (eocd >= 20 && readU32(&tail[eocd - 20]) == 0x07064b50) {
+    const std::uint64_t eocd64_offset = readU64(&tail[eocd - 20 + 8]);
+    unsigned char eocd64[56];
+    in.seekg(static_cast<std::streamoff>(eocd64_offset));
+    in.read(reinterpret_cast<char *>(eocd64), sizeof(eocd64));
+    if (!in || readU32(eocd64) != 0x06064b50) {
+      std::cerr << "Corrupt ZIP64 directory: " << path << std::endl;
+      return false;
+    }
+    entry_count = readU64(eocd64 + 32);
+    directory_size = readU64(eocd64 + 40);
+    directory_offset = readU64(eocd64 + 48);
+  }
+
+  std::vector<unsigned char> directory(directory_size);
+  in.seekg(static_cast<std::streamoff>(directory_offset));
+  in.read(reinterpret_cast<char *>(directory.data()),
+          static_cast<std::streamsize>(directory_size));
+  if (!in) {
+    std::cerr << "Failed to read zip directory: " << path << std::endl;
+    return false;
+  }
+
+  std::size_t pos = 0;
+  for (std::uint64_t i = 0; i < entry_count; ++i) {
+    if (pos + 46 > directory.size() ||
+        readU32(&directory[pos]) != 0x02014b50) {
+      std::cerr << "Corrupt zip directory: " << path << std::endl;
+      return false;
+    }
+
+    const unsigned char *header = &directory[pos];
+    const std::uint16_t name_length = readU16(header + 28);
+    const std::uint16_t extra_length = readU16(header + 30);
+    const std::uint16_t comment_length = readU16(header + 32);
+    if (pos + 46 + name_length + extra_length + comment_length >
+        directory.size()) {
+      std::cerr << "Corrupt zip directory: " << path << std::endl;
+      return false;
+    }
+
+    const std::string name(reinterpret_cast<const char *>(header + 46),
+                           name_length);
+    if (memberMatches(name, member)) {
+      entry.method = readU16(header + 10);
+      std::uint64_t compressed_size = readU32(header + 20);
+      std::uint64_t uncompressed_size = readU32(header + 24);
+      std::uint64_t local_header_offset = readU32(header + 42);
+
+      // ZIP64 extended information replaces the saturated 32-bit fields, in
+      // the fixed order uncompressed, compressed, offset
+      const unsigned char *extra = header + 46 + name_length;
+      for (std::size_t e = 0; e + 4 <= extra_length;) {
+        const std::uint16_t id = readU16(extra + e);
+        const std::uint16_t size = readU16(extra + e + 2);
+        if (id == 0x0001) {
+          const unsigned char *field = extra + e + 4;
+          const unsigned char *field_end = field + size;
+          if (uncompressed_size == 0xFFFFFFFF && field + 8 <= field_end) {
+            uncompressed_size = readU64(field);
+            field += 8;
+          }
+          if (compressed_size == 0xFFFFFFFF && field + 8 <= field_end) {
+            compressed_size = readU64(field);
+            field += 8;
+          }
+          if (local_header_offset == 0xFFFFFFFF && field + 8 <= field_end) {
+            local_header_offset = readU64(field);
+          }
+        }
+        e += 4 + size;
+      }
+
+      entry.compressed_size = compressed_size;
+      entry.local_header_offset = local_header_offset;
+      return true;
+    }
+
+    pos += 46 + name_length + extra_length + comment_length;
+  }
+
+  std::cerr << "Member " << member << " not found in zip archive: " << path
+            << std::endl;
+  return false;
+}
+
+} // namespace
+
+DecompressingStreamBuf::DecompressingStreamBuf(const std::string &path,
+                                               Format format,
+                                               const std::string &member,
+                                               std::size_t ring_capacity)
+    : path(path), format(format), member(member), ring(ring_capacity),
+      get_area(GET_AREA_SIZE) {
+  setg(get_area.data(), get_area.data(), get_area.data());
+  producer = std::thread(&DecompressingStreamBuf::produce, this);
+}
+
+DecompressingStreamBuf::~DecompressingStreamBuf() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    cancelled = true;
+  }
+  not_full.notify_all();
+  if (producer.joinable()) {
+    producer.join();
+  }
+}
+
+bool DecompressingStreamBuf::Failed() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return failed;
+}
+
+DecompressingStreamBuf::int_type DecompressingStreamBuf::underflow() {
+  if (gptr() < egptr()) {
+    return traits_type::to_int_type(*gptr());
+  }
+
+  const std::size_t n = read(get_area.data(), get_area.size());
+  if (n == 0) {
+    return traits_type::eof();
+  }
+
+  setg(get_area.data(), get_area.data(), get_area.data() + n);
+  return traits_type::to_int_type(*gptr());
+}
+
+bool DecompressingStreamBuf::write(const char *data, std::size_t size) {
+  while (size > 0) {
+    std::unique_lock<std::mutex> lock(mutex);
+    not_full.wait(lock, [this] { return count < ring.size() || cancelled; });
+    if (cancelled) {
+      return false;
+    }
+
+    // Copy into the free region, which may wrap around the end of the ring
+    const std::size_t tail = (head + count) % ring.size();
+    const std::size_t n =
+        std::min({size, ring.size() - count, ring.size() - tail});
+    std::memcpy(ring.data() + tail, data, n);
+    count += n;
+    data += n;
+    size -= n;
+
+    lock.unlock();
+    not_empty.notify_one();
+  }
+  return true;
+}
+
+std::size_t DecompressingStreamBuf::read(char *data, std::size_t size) {
+  std::unique_lock<std::mutex> lock(mutex);
+  not_empty.wait(lock, [this] { return count > 0 || finished; });
+
+  std::size_t copied = 0;
+  while (copied < size && count > 0) {
+    const std::size_t n =
+        std::min({size - copied, count, ring.size() - head});
+    std::memcpy(data + copied, ring.data() + head, n);
+    head = (head + n) % ring.size();
+    count -= n;
+    copied += n;
+  }
+
+  lock.unlock();
+  not_full.notify_one();
+  return copied;
+}
+
+void DecompressingStreamBuf::finish(bool producer_failed) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+    failed = producer_failed;
+  }
+  not_empty.notify_all();
+}
+
+void DecompressingStreamBuf::produce() {
+  bool ok = false;
+  try {
+    ok = format == Format::Gzip ? produceGzip() : produceZipMember();
+  } catch (const std::exception &e) {
+    std::cerr << "Failed to decompress " << path << ": " << e.what()
+              << std::endl;
+  }
+  finish(!ok);
+}
+
+bool DecompressingStreamBuf::produceGzip() {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    std::cerr << "Cannot open compressed input file: " << path << std::endl;
+    return false;
+  }
+
+  z_stream zs{};
+  // 15 + 32: maximum window, automatic gzip/zlib header detection
+  if (inflateInit2(&zs, 15 + 32) != Z_OK) {
+    std::cerr << "Cannot initialize zlib for: " << path << std::endl;
+    return false;
+  }
+
+  std::vector<char> input(READ_CHUNK_SIZE);
+  std::vector<char> output(READ_CHUNK_SIZE);
+  bool ok = true;
+  int rc = Z_OK;
+
+  while (ok) {
+    if (zs.avail_in == 0) {
+      in.read(input.data(), static_cast<std::streamsize>(input.size()));
+      zs.avail_in = static_cast<uInt>(in.gcount());
+      zs.next_in = reinterpret_cast<Bytef *>(input.data());
+      if (zs.avail_in == 0) {
+        // Input ended; only valid right after a complete gzip member
+        if (rc != Z_STREAM_END) {
+          std::cerr << "Truncated gzip file: " << path << std::endl;
+          ok = false;
+        }
+        break;
+      }
+    }
+
+    // Concatenated gzip members form one logical stream
+    if (rc == Z_STREAM_END) {
+      inflateReset(&zs);
+    }
+
+    zs.next_out = reinterpret_cast<Bytef *>(output.data());
+    zs.avail_out = static_cast<uInt>(output.size());
+    rc = inflate(&zs, Z_NO_FLUSH);
+    if (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR) {
+      std::cerr << "Corrupt gzip data in " << path << ": "
+                << (zs.msg ? zs.msg : "unknown error") << std::endl;
+      ok = false;
+      break;
+    }
+
+    const std::size_t produced = output.size() - zs.avail_out;
+    if (produced > 0 && !write(output.data(), produced)) {
+      break; // Consumer stopped reading
+    }
+  }
+
+  inflateEnd(&zs);
+  return ok;
+}
+
+bool DecompressingStreamBuf::produceZipMember() {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    std::cerr << "Cannot open zip archive: " << path << std::endl;
+    return false;
+  }
+
+  ZipEntry entry;
+  if (!findZipEntry(in, path, member, entry)) {
+    return false;
+  }
+
+  if (entry.method != 0 && entry.method != 8) {
+    std::cerr << "Unsupported zip compression method " << entry.method
+              << " for " << member << " in " << path << std::endl;
+    return false;
+  }
+
+  // The local header repeats the name and has its own extra field length
+  unsigned char local_header[30];
+  in.seekg(static_cast<std::streamoff>(entry.local_header_offset));
+  in.read(reinterpret_cast<char *>(local_header), sizeof(local_header));
+  if (!in || readU32(local_header) != 0x04034b50) {
+    std::cerr << "Corrupt zip local header for " << member << " in " << path
+              << std::endl;
+    return false;
+  }
+  const std::uint64_t data_offset = entry.local_header_offset + 30 +
+                                    readU16(local_header + 26) +
+                                    readU16(local_header + 28);
+  in.seekg(static_cast<std::streamoff>(data_offset));
+
+  std::vector<char> input(READ_CHUNK_SIZE);
+  std::uint64_t remaining = entry.compressed_size;
+
+  // Stored members are copied through unchanged
+  if (entry.method == 0) {
+    while (remaining > 0) {
+      const auto n = static_cast<std::size_t>(
+          std::min<std::uint64_t>(remaining, input.size()));
+      in.read(input.data(), static_cast<std::streamsize>(n));
+      if (static_cast<std::size_t>(in.gcount()) != n) {
+        std::cerr << "Truncated zip member " << member << " in " << path
+                  << std::endl;
+        return false;
+      }
+      remaining -= n;
+      if (!write(input.data(), n)) {
+        return true;
+      }
+    }
+    return true;
+  }
+
+  z_stream zs{};
+  // Negative window bits: raw deflate data without a zlib header
+  if (inflateInit2(&zs, -MAX_WBITS) != Z_OK) {
+    std::cerr << "Cannot initialize zlib for: " << path << std::endl;
+    return false;
+  }
+
+  std::vector<char> output(READ_CHUNK_SIZE);
+  bool ok = true;
+  int rc = Z_OK;
+
+  while (rc != Z_STREAM_END) {
+    if (zs.avail_in == 0) {
+      if (remaining == 0) {
+        std::cerr << "Truncated zip member " << member << " in " << path
+                  << std::endl;
+        ok = false;
+        break;
+      }
+      const auto n = static_cast<std::size_t>(
+          std::min<std::uint64_t>(remaining, input.size()));
+      in.read(input.data(), static_cast<std::streamsize>(n));
+      if (static_cast<std::size_t>(in.gcount()) != n) {
+        std::cerr << "Truncated zip member " << member << " in " << path
+                  << std::endl;
+        ok = false;
+        break;
+      }
+      remaining -= n;
+      zs.avail_in = static_cast<uInt>(n);
+      zs.next_in = reinterpret_cast<Bytef *>(input.data());
+    }
+
+    zs.next_out = reinterpret_cast<Bytef *>(output.data());
+    zs.avail_out = static_cast<uInt>(output.size());
+    rc = inflate(&zs, Z_NO_FLUSH);
+    if (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR) {
+      std::cerr << "Corrupt deflate data for " << member << " in " << path
+                << ": " << (zs.msg ? zs.msg : "unknown error") << std::endl;
+      ok = false;
+      break;
+    }
+
+    const std::size_t produced = output.size() - zs.avail_out;
+    if (produced > 0 && !write(output.data(), produced)) {
+      break; // Consumer stopped reading
+    }
+  }
+
+  inflateEnd(&zs);
+  return ok;
+}
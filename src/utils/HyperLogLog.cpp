@@ -0,0 +1,30 @@
+#include "utils/HyperLogLog.h"
+#include <algorithm>
+#include <cmath>
+
+void HyperLogLog::Merge(const HyperLogLog &other) {
+  for (std::size_t i = 0; i < registers.size(); ++i) {
+    registers[i] = std::max(registers[i], other.registers[i]);
+  }
+}
+
+double HyperLogLog::Estimate() const {
+  const auto m = static_cast<double>(registers.size());
+
+  double sum = 0.0;
+  std::size_t zeros = 0;
+  for (std::uint8_t rank : registers) {
+    sum += std::ldexp(1.0, -static_cast<int>(rank));
+    zeros += rank == 0 ? 1 : 0;
+  }
+
+  const double alpha = 0.7213 / (1.0 + 1.079 / m);
+  const double estimate = alpha * m * m / sum;
+
+  // Linear counting is more accurate while many registers are still empty;
+  // 64-bit hashes make a large-range correction unnecessary
+  if (estimate <= 2.5 * m && zeros > 0) {
+    return m * std::log(m / static_cast<double>(zeros));
+  }
+  return estimate;
+}
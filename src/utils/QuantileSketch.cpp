@@ -0,0 +1,138 @@
+#include "utils/QuantileSketch.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr double GAMMA = (1.0 + QuantileSketch::RELATIVE_ACCURACY) /
+                         (1.0 - QuantileSketch::RELATIVE_ACCURACY);
+
+/** Values below this are counted as zero */
+constexpr double MIN_INDEXABLE = 1e-9;
+
+const double LOG_GAMMA = std::log(GAMMA);
+
+/** Index of the bucket holding a positive value */
+std::int32_t bucketIndex(double value) {
+  return static_cast<std::int32_t>(std::ceil(std::log(value) / LOG_GAMMA));
+}
+
+/** Representative value of a bucket, within the relative accuracy */
+double bucketValue(std::int32_t index) {
+  return 2.0 * std::pow(GAMMA, index) / (GAMMA + 1.0);
+}
+
+} // namespace
+
+void QuantileSketch::Add(double value) {
+  if (std::isnan(value)) {
+    return;
+  }
+
+  if (count == 0) {
+    min = max = value;
+  } else {
+    min = std::min(min, value);
+    max = std::max(max, value);
+  }
+  ++count;
+
+  if (value > MIN_INDEXABLE) {
+    addToBucket(positive, bucketIndex(value), 1);
+  } else if (value < -MIN_INDEXABLE) {
+    addToBucket(negative, bucketIndex(-value), 1);
+  } else {
+    ++zero_count;
+  }
+}
+
+void QuantileSketch::Merge(const QuantileSketch &other) {
+  if (other.count == 0) {
+    return;
+  }
+  if (count == 0) {
+    *this = other;
+    return;
+  }
+
+  min = std::min(min, other.min);
+  max = std::max(max, other.max);
+  count += other.count;
+  zero_count += other.zero_count;
+  mergeBuckets(positive, other.positive);
+  mergeBuckets(negative, other.negative);
+}
+
+double QuantileSketch::Quantile(double q) const {
+  if (count == 0) {
+    return 0.0;
+  }
+  q = std::clamp(q, 0.0, 1.0);
+  const auto rank =
+      static_cast<std::uint64_t>(q * static_cast<double>(count - 1));
+
+  // Walk the values in ascending order: negatives from the largest
+  // magnitude down, then zeros, then positives
+  double value = 0.0;
+  std::uint64_t seen = 0;
+  bool found = false;
+  for (auto bucket = negative.rbegin(); bucket != negative.rend(); ++bucket) {
+    seen += bucket->count;
+    if (seen > rank) {
+      value = -bucketValue(bucket->index);
+      found = true;
+      break;
+    }
+  }
+  if (!found) {
+    seen += zero_count;
+    found = seen > rank;
+  }
+  if (!found) {
+    for (const Bucket &bucket : positive) {
+      seen += bucket.count;
+      if (seen > rank) {
+        value = bucketValue(bucket.index);
+        break;
+      }
+    }
+  }
+
+  return std::clamp(value, min, max);
+}
+
+void QuantileSketch::addToBucket(std::vector<Bucket> &buckets,
+                                 std::int32_t index, std::uint32_t count) {
+  auto it = std::lower_bound(
+      buckets.begin(), buckets.end(), index,
+      [](const Bucket &bucket, std::int32_t i) { return bucket.index < i; });
+  if (it != buckets.end() && it->index == index) {
+    it->count += count;
+  } else {
+    buckets.insert(it, Bucket{index, count});
+  }
+}
+
+void QuantileSketch::mergeBuckets(std::vector<Bucket> &into,
+                                  const std::vector<Bucket> &from) {
+  if (from.empty()) {
+    return;
+  }
+  std::vector<Bucket> merged;
+  merged.reserve(into.size() + from.size());
+
+  auto a = into.begin();
+  auto b = from.begin();
+  while (a != into.end() || b != from.end()) {
+    if (b == from.end() || (a != into.end() && a->index < b->index)) {
+      merged.push_back(*a++);
+    } else if (a == into.end() || b->index < a->index) {
+      merged.push_back(*b++);
+    } else {
+      merged.push_back(Bucket{a->index, a->count + b->count});
+      ++a;
+      ++b;
+    }
+  }
+  into = std::move(merged);
+}
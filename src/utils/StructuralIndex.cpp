@@ -0,0 +1,285 @@
+#include "utils/StructuralIndex.h"
+#include <atomic>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define STRUCTURAL_INDEX_X86 1
+#endif
+
+namespace {
+
+/** Classification of one 64-byte block; bit i describes byte i */
+struct BlockMasks {
+  std::uint64_t quote;
+  std::uint64_t separator; ///< Commas and newlines
+  std::uint64_t line_feed;
+};
+
+/** Quote state and output carried from block to block */
+struct ScanState {
+  std::vector<std::uint32_t> &separators;
+  std::size_t count = 0;
+  std::uint64_t *quotes;
+  std::uint64_t *line_feeds;
+  std::uint64_t inside = 0; ///< All ones while inside a quoted field
+};
+
+/**
+ * Turns every set bit into a toggle: bit i of the result is the parity of
+ * the bits at or below i, i.e. set from each opening quote up to (but not
+ * including) its closing quote.
+ */
+inline std::uint64_t prefixXor(std::uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+/** Records the quotes of a block and appends its unquoted separators */
+inline void consumeBlock(const BlockMasks &masks, std::size_t offset,
+                         ScanState &state) {
+  state.quotes[offset / 64] = masks.quote;
+  state.line_feeds[offset / 64] = masks.line_feed;
+
+  const std::uint64_t inside = prefixXor(masks.quote) ^ state.inside;
+  state.inside =
+      static_cast<std::uint64_t>(static_cast<std::int64_t>(inside) >> 63);
+  std::uint64_t bits = masks.separator & ~inside;
+
+  if (state.count + 64 > state.separators.size()) {
+    state.separators.resize(state.separators.size() * 2 + 64);
+  }
+  std::uint32_t *out = state.separators.data() + state.count;
+  state.count += static_cast<std::size_t>(std::popcount(bits));
+  while (bits != 0) {
+    *out++ = static_cast<std::uint32_t>(offset) +
+             static_cast<std::uint32_t>(std::countr_zero(bits));
+    bits &= bits - 1;
+  }
+}
+
+BlockMasks classifyScalar(const char *block) {
+  BlockMasks masks{0, 0, 0};
+  for (unsigned i = 0; i < 64; ++i) {
+    const std::uint64_t bit = std::uint64_t{1} << i;
+    switch (block[i]) {
+    case '"':
+      masks.quote |= bit;
+      break;
+    case '\n':
+      masks.line_feed |= bit;
+      masks.separator |= bit;
+      break;
+    case ',':
+    case '\r':
+      masks.separator |= bit;
+      break;
+    default:
+      break;
+    }
+  }
+  return masks;
+}
+
+void buildScalar(const char *data, std::size_t size, ScanState &state) {
+  std::size_t offset = 0;
+  for (; offset + 64 <= size; offset += 64) {
+    consumeBlock(classifyScalar(data + offset), offset, state);
+  }
+  if (offset < size) {
+    char block[64] = {};
+    std::memcpy(block, data + offset, size - offset);
+    consumeBlock(classifyScalar(block), offset, state);
+  }
+}
+
+#ifdef STRUCTURAL_INDEX_X86
+
+/** SSE2 is part of x86-64, so this kernel needs no target attribute */
+inline BlockMasks classifySse2(const char *block) {
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i comma = _mm_set1_epi8(',');
+  const __m128i lf = _mm_set1_epi8('\n');
+  const __m128i cr = _mm_set1_epi8('\r');
+
+  BlockMasks masks{0, 0, 0};
+  for (unsigned i = 0; i < 4; ++i) {
+    const __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 16 * i));
+    const __m128i line_feed = _mm_cmpeq_epi8(bytes, lf);
+    const __m128i separator =
+        _mm_or_si128(_mm_cmpeq_epi8(bytes, comma),
+                     _mm_or_si128(line_feed, _mm_cmpeq_epi8(bytes, cr)));
+    masks.quote |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(
+                       _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, quote))))
+                   << (16 * i);
+    masks.separator |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(
+                           _mm_movemask_epi8(separator)))
+                       << (16 * i);
+    masks.line_feed |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(
+                           _mm_movemask_epi8(line_feed)))
+                       << (16 * i);
+  }
+  return masks;
+}
+
+void buildSse2(const char *data, std::size_t size, ScanState &state) {
+  std::size_t offset = 0;
+  for (; offset + 64 <= size; offset += 64) {
+    consumeBlock(classifySse2(data + offset), offset, state);
+  }
+  if (offset < size) {
+    char block[64] = {};
+    std::memcpy(block, data + offset, size - offset);
+    consumeBlock(classifySse2(block), offset, state);
+  }
+}
+
+__attribute__((target("avx2"))) inline std::uint64_t
+movemask64(__m256i low, __m256i high) {
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(low)) |
+         static_cast<std::uint64_t>(
+             static_cast<std::uint32_t>(_mm256_movemask_epi8(high)))
+             << 32;
+}
+
+__attribute__((target("avx2"))) inline __m256i
+separatorsAvx2(__m256i bytes, __m256i line_feed) {
+  return _mm256_or_si256(
+      _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(',')),
+      _mm256_or_si256(line_feed,
+                      _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\r'))));
+}
+
+__attribute__((target("avx2"))) inline BlockMasks
+classifyAvx2(const char *block) {
+  const __m256i quote = _mm256_set1_epi8('"');
+  const __m256i low =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+  const __m256i high =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + 32));
+
+  const __m256i lf = _mm256_set1_epi8('\n');
+  const __m256i low_line_feed = _mm256_cmpeq_epi8(low, lf);
+  const __m256i high_line_feed = _mm256_cmpeq_epi8(high, lf);
+
+  return {movemask64(_mm256_cmpeq_epi8(low, quote),
+                     _mm256_cmpeq_epi8(high, quote)),
+          movemask64(separatorsAvx2(low, low_line_feed),
+                     separatorsAvx2(high, high_line_feed)),
+          movemask64(low_line_feed, high_line_feed)};
+}
+
+__attribute__((target("avx2"))) void
+buildAvx2(const char *data, std::size_t size, ScanState &state) {
+  std::size_t offset = 0;
+  for (; offset + 64 <= size; offset += 64) {
+    consumeBlock(classifyAvx2(data + offset), offset, state);
+  }
+  if (offset < size) {
+    char block[64] = {};
+    std::memcpy(block, data + offset, size - offset);
+    consumeBlock(classifyAvx2(block), offset, state);
+  }
+}
+
+#endif
+
+/** Counts the bits of a per-block bitmap for the bytes [begin, end) */
+std::size_t countBits(const std::vector<std::uint64_t> &bitmap,
+                      std::size_t begin, std::size_t end) {
+  if (begin >= end) {
+    return 0;
+  }
+  const std::size_t first = begin / 64;
+  const std::size_t last = (end - 1) / 64;
+  const std::uint64_t head = ~std::uint64_t{0} << (begin % 64);
+  const std::uint64_t tail = ~std::uint64_t{0} >> (63 - (end - 1) % 64);
+
+  if (first == last) {
+    return static_cast<std::size_t>(
+        std::popcount(bitmap[first] & head & tail));
+  }
+  std::size_t total =
+      static_cast<std::size_t>(std::popcount(bitmap[first] & head));
+  for (std::size_t block = first + 1; block < last; ++block) {
+    total += static_cast<std::size_t>(std::popcount(bitmap[block]));
+  }
+  return total + static_cast<std::size_t>(std::popcount(bitmap[last] & tail));
+}
+
+/** Best kernel the CPU supports */
+StructuralIndex::Kernel supportedKernel() {
+#ifdef STRUCTURAL_INDEX_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return StructuralIndex::Kernel::Avx2;
+  }
+  return StructuralIndex::Kernel::Sse2;
+#else
+  return StructuralIndex::Kernel::Scalar;
+#endif
+}
+
+std::atomic<StructuralIndex::Kernel> active_kernel = supportedKernel();
+
+} // namespace
+
+StructuralIndex::Kernel StructuralIndex::ActiveKernel() {
+  return active_kernel;
+}
+
+void StructuralIndex::SetKernel(Kernel kernel) {
+  const Kernel supported = supportedKernel();
+  active_kernel = kernel > supported ? supported : kernel;
+}
+
+const char *StructuralIndex::KernelName(Kernel kernel) {
+  switch (kernel) {
+  case Kernel::Avx2:
+    return "avx2";
+  case Kernel::Sse2:
+    return "sse2";
+  case Kernel::Scalar:
+    break;
+  }
+  return "scalar";
+}
+
+void StructuralIndex::Build(const char *data, std::size_t size) {
+  quotes.resize((size + 63) / 64);
+  line_feeds.resize(quotes.size());
+  ScanState state{separators, 0, quotes.data(), line_feeds.data()};
+
+  switch (active_kernel.load(std::memory_order_relaxed)) {
+#ifdef STRUCTURAL_INDEX_X86
+  case Kernel::Avx2:
+    buildAvx2(data, size, state);
+    break;
+  case Kernel::Sse2:
+    buildSse2(data, size, state);
+    break;
+#endif
+  default:
+    buildScalar(data, size, state);
+    break;
+  }
+
+  count = state.count;
+}
+
+std::size_t StructuralIndex::CountQuotes(std::size_t begin,
+                                         std::size_t end) const {
+  return countBits(quotes, begin, end);
+}
+
+std::size_t StructuralIndex::CountLineFeeds(std::size_t begin,
+                                            std::size_t end) const {
+  return countBits(line_feeds, begin, end);
+}
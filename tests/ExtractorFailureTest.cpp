@@ -0,0 +1,154 @@
+/**
+ * @file ExtractorFailureTest.cpp
+ * @brief Checks that an input ending early is reported by the extractor
+ * rather than passed on as a complete table.
+ */
+
+#include "services/extractors/Extractor.h"
+#include "services/extractors/schemas/FoodNutrientSchema.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+using FoodNutrientExtractor = Extractor<USDA::FoodNutrientSchema>;
+
+int failures = 0;
+
+/** Records a failed check without stopping the remaining ones */
+void check(bool condition, const std::string &what) {
+  if (!condition) {
+    std::cerr << "FAILED: " << what << std::endl;
+    ++failures;
+  }
+}
+
+/** Returns a food_nutrient.csv with the given number of rows */
+std::string foodNutrientCsv(std::size_t rows) {
+  std::string csv = "\"id\",\"fdc_id\",\"nutrient_id\",\"amount\","
+                    "\"data_points\",\"derivation_id\",\"min\",\"max\","
+                    "\"median\",\"loq\",\"footnote\",\"min_year_acquired\","
+                    "\"percent_daily_value\"\n";
+  for (std::size_t i = 0; i < rows; ++i) {
+    csv += "\"" + std::to_string(i + 1) + "\",\"" +
+           std::to_string(i / 50 + 1) + "\",\"" +
+           std::to_string(1000 + i % 50) +
+           "\",\"0.5\",\"\",\"\",\"\",\"\",\"\",\"\",\"\",\"\",\"\"\n";
+  }
+  return csv;
+}
+
+/** Writes the contents gzip-compressed */
+bool writeGzip(const fs::path &path, const std::string &contents) {
+  gzFile file = gzopen(path.c_str(), "wb");
+  if (!file) {
+    return false;
+  }
+  const bool written =
+      gzwrite(file, contents.data(), static_cast<unsigned>(contents.size())) ==
+      static_cast<int>(contents.size());
+  return gzclose(file) == Z_OK && written;
+}
+
+/** Writes the contents as they are */
+bool writePlain(const fs::path &path, const std::string &contents) {
+  std::ofstream file(path, std::ios::binary);
+  file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+  return static_cast<bool>(file);
+}
+
+/** Extracts the table and returns the number of rows read */
+std::size_t extract(FoodNutrientExtractor &extractor) {
+  return extractor.TakeEntries().size();
+}
+
+void testIntactGzip(const fs::path &directory) {
+  const fs::path path = directory / "intact.csv.gz";
+  check(writeGzip(path, foodNutrientCsv(20000)), "write intact gzip");
+
+  FoodNutrientExtractor extractor(path, directory / "rejects", 0);
+  check(extract(extractor) == 20000, "intact gzip: all rows read");
+  check(!extractor.Failed(), "intact gzip: not failed");
+}
+
+void testTruncatedGzip(const fs::path &directory) {
+  const fs::path path = directory / "truncated.csv.gz";
+  check(writeGzip(path, foodNutrientCsv(20000)), "write truncated gzip");
+  fs::resize_file(path, fs::file_size(path) / 2);
+
+  FoodNutrientExtractor extractor(path, directory / "rejects", 0);
+  const std::size_t rows = extract(extractor);
+  check(rows < 20000, "truncated gzip: rows lost");
+  check(extractor.Failed(), "truncated gzip: failed");
+}
+
+void testMissingInput(const fs::path &directory) {
+  FoodNutrientExtractor extractor(directory / "missing.csv.gz",
+                                  directory / "rejects", 0);
+  check(extract(extractor) == 0, "missing input: no rows");
+  check(extractor.Failed(), "missing input: failed");
+}
+
+/** Streams a plain input with the backend, comparing against `rows` */
+void testPlainInput(const fs::path &directory, CsvInput::ReadBackend backend,
+                    const std::string &name) {
+  // Larger than the blocks the reader keeps in flight (4 x 4 MiB), so that
+  // the end of the file is only read after the first batch is returned
+  const std::size_t rows = 600000;
+  const fs::path path = directory / (name + ".csv");
+  check(writePlain(path, foodNutrientCsv(rows)), name + ": write input");
+  CsvInput::SetReadBackend(backend);
+
+  bool failed = true;
+  std::size_t read = 0;
+  for (const auto &batch : FoodNutrientExtractor::Stream(path, 1000, &failed)) {
+    read += batch.size();
+  }
+  check(read == rows, name + ": all rows read");
+  check(!failed, name + ": intact input not failed");
+
+  // Truncating the file while it is read makes the remaining reads come up
+  // short, as an I/O error would
+  read = 0;
+  bool truncated = false;
+  for (const auto &batch : FoodNutrientExtractor::Stream(path, 1000, &failed)) {
+    read += batch.size();
+    if (!truncated) {
+      fs::resize_file(path, fs::file_size(path) / 3 * 2 + 13);
+      truncated = true;
+    }
+  }
+  check(read < rows, name + ": rows lost");
+  check(failed, name + ": truncated input failed");
+
+  CsvInput::SetReadBackend(CsvInput::ReadBackend::Mmap);
+}
+
+} // namespace
+
+int main() {
+  const fs::path directory =
+      fs::temp_directory_path() /
+      ("usda-etl-extractor-test-" + std::to_string(::getpid()));
+  fs::create_directories(directory);
+
+  testIntactGzip(directory);
+  testTruncatedGzip(directory);
+  testMissingInput(directory);
+  testPlainInput(directory, CsvInput::ReadBackend::Pread, "pread");
+  testPlainInput(directory, CsvInput::ReadBackend::IoUring, "io_uring");
+
+  fs::remove_all(directory);
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All extractor failure checks passed" << std::endl;
+  return 0;
+}